@@ -0,0 +1,81 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Block Sparse Table supporting associative and idempotent range queries on
+//   a static array with linear memory
+// The array is split into blocks of B elements, and the aggregates of the
+//   prefixes and suffixes within each block are stored along with a sparse
+//   table over the aggregates of the blocks, all in a single flat buffer, so
+//   a query crossing a block boundary combines a suffix, at most two entries
+//   of the sparse table, and a prefix, while a query within a single block
+//   is answered by a prefix or suffix if it touches a block boundary, and
+//   otherwise by combining at most B - 2 adjacent elements
+// Indices are 0-indexed and ranges are inclusive
+// Template Arguments:
+//   T: the type of each element
+//   Op: a struct with the operation (can also be of type
+//       std::function<T(T, T)>); in practice, custom struct is faster than
+///      std::function
+//     Required Functions:
+//       operator (l, r): combines the values l and r, must be
+//         associative and idempotent
+//   B: the size of each block
+// Constructor Arguments:
+//   A: a vector of type T
+//   op: an instance of the Op struct
+// Fields:
+//   N: the size of the array
+//   M: the number of blocks
+//   H: the number of levels of the sparse table over the blocks
+// Functions:
+//   query(l, r): returns the aggregate value of the elements in
+//     the range [l, r]
+// In practice, the constructor has a small constant and is significantly
+//   faster than sparse table's constructor, and query has a moderate constant
+//   and is slightly faster than sparse table's query on random ranges, while
+//   using about 3N + N / B log (N / B) elements of memory instead of N log N
+// Time Complexity:
+//   constructor: O(N + N / B log (N / B))
+//   query: O(1) for ranges crossing a block boundary, O(B) otherwise
+// Memory Complexity: O(N + N / B log (N / B))
+// Tested:
+//   Fuzz and Stress Tested
+template <class T, class Op, const int B = 16> struct BlockSparseTable {
+  static_assert(B >= 1, "B must be positive");
+  int N, M, H; vector<T> buf; Op op;
+  const T *pre() const { return buf.data() + size_t(N); }
+  const T *suf() const { return buf.data() + size_t(N) * 2; }
+  const T *level(int k) const {
+    return buf.data() + size_t(N) * 3 + size_t(M) * k;
+  }
+  BlockSparseTable(const vector<T> &A, Op op = Op())
+      : N(A.size()), M((N + B - 1) / B), H(M == 0 ? 0 : __lg(M) + 1),
+        op(op) {
+    size_t tot = size_t(N) * 3 + size_t(M) * H; buf.reserve(tot);
+    buf = A; buf.resize(tot, T()); T *a = buf.data(), *p = a + N;
+    T *s = a + size_t(N) * 2, *t = a + size_t(N) * 3;
+    for (int b = 0; b < M; b++) {
+      int lo = b * B, hi = min(N, lo + B); p[lo] = a[lo];
+      for (int i = lo + 1; i < hi; i++) p[i] = op(p[i - 1], a[i]);
+      s[hi - 1] = a[hi - 1];
+      for (int i = hi - 2; i >= lo; i--) s[i] = op(a[i], s[i + 1]);
+      t[b] = p[hi - 1];
+    }
+    for (int k = 0; k < H - 1; k++) {
+      const T *u = t + size_t(M) * k; T *v = t + size_t(M) * (k + 1);
+      for (int j = 0; j < M; j++) v[j] = op(u[j], u[min(j + (1 << k), M - 1)]);
+    }
+  }
+  T query(int l, int r) {
+    int bl = l / B, br = r / B; if (bl == br) {
+      if (l == bl * B) return pre()[r];
+      if (r == min(N, bl * B + B) - 1) return suf()[l];
+      T ret = buf[l]; for (int i = l + 1; i <= r; i++) ret = op(ret, buf[i]);
+      return ret;
+    }
+    if (++bl > --br) return op(suf()[l], pre()[r]);
+    int k = __lg(br - bl + 1); const T *u = level(k);
+    return op(op(suf()[l], op(u[bl], u[br - (1 << k) + 1])), pre()[r]);
+  }
+};
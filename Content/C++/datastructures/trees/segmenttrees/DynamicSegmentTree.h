@@ -3,6 +3,11 @@
 using namespace std;
 
 // Top down dynamic segment tree supporting range updates and range queries
+// The nodes are stored in a pool of blocks of 2^16 nodes, where each block
+//   is allocated at its full size when it is first used, and refer to each
+//   other with 32-bit indices, so growing the pool never copies or moves the
+//   existing nodes, and versions that are no longer needed can be released
+//   and their nodes reclaimed with a mark-compact pass
 // Indices are 0-indexed and ranges are inclusive
 // Template Arguments:
 //   IndexType: the type of the index of the array
@@ -76,12 +81,29 @@ using namespace std;
 //     is -1) such that f(query(i, r)) returns true of l - 1 if none exist
 //   revert(rootInd): creates a new version based off of version rootInd
 //   reserveNodes(k): reserves space for k nodes in the dynamic segment tree
+//   release(rootInd): marks the version rootInd as no longer needed, so that
+//     the nodes only it reaches can be reclaimed by collect, where rootInd
+//     must not be the latest version
+//   collect(): reclaims the nodes that no live version reaches by marking
+//     the nodes reachable from the live versions and sliding them to the
+//     front of the pool, which renumbers the nodes but keeps the indices of
+//     the versions
+//   nodeCount(): returns the number of nodes in the pool
+//   memoryUsage(): returns the number of bytes reserved by the tree
+//   versionNodes(rootInd): returns the number of nodes reachable from the
+//     version rootInd
+//   retainedNodes(rootInd): returns the number of nodes reachable from the
+//     version rootInd and no other live version, which is the number of
+//     nodes release(rootInd) followed by collect() would reclaim
 // In practice, has a moderate constant
 // Time Complexity:
 //   constructor: O(1) for size constructor,
 //                O(N) for iteartor and generating function constructors
 //   update, query, bsearchPrefix, bsearchSuffix: O(log N) amortized unless
 //     reserveNodes is called beforehand
+//   release, nodeCount, memoryUsage: O(1)
+//   collect, versionNodes, retainedNodes: O(S + V) for S nodes in the pool
+//     and V versions
 // Memory Complexity: O(U log N) for U updates for single argument constructor,
 //                    O(N + U log N) for two argument constructor 
 // Tested:
@@ -106,7 +128,39 @@ struct DynamicSegmentTree {
     Data val; Lazy lz; int l, r;
     Node(const Data &val) : val(val), lz(C::ldef()), l(-1), r(-1) {}
   };
-  IndexType N; vector<int> roots; vector<Node<LAZY>> TR;
+  struct NodePool {
+    static const int SHIFT = 16, BLOCK = 1 << SHIFT;
+    vector<vector<Node<LAZY>>> blocks; int sz = 0;
+    Node<LAZY> &operator [] (int i) {
+      return blocks[i >> SHIFT][i & (BLOCK - 1)];
+    }
+    int size() const { return sz; }
+    vector<Node<LAZY>> &block(int b) {
+      if (b == int(blocks.size())) blocks.emplace_back();
+      if (int(blocks[b].capacity()) < BLOCK) blocks[b].reserve(BLOCK);
+      return blocks[b];
+    }
+    vector<Node<LAZY>> &last() { return block(sz >> SHIFT); }
+    void push_back(const Node<LAZY> &x) { last().push_back(x); sz++; }
+    template <class ...Args> void emplace_back(Args &&...args) {
+      last().emplace_back(forward<Args>(args)...); sz++;
+    }
+    void reserve(int k) {
+      for (int b = 0; b * BLOCK < k; b++) block(b);
+    }
+    void shrink(int k) {
+      blocks.resize((k + BLOCK - 1) >> SHIFT); if (k % BLOCK != 0)
+        blocks.back().erase(blocks.back().begin() + k % BLOCK,
+                            blocks.back().end());
+      sz = k;
+    }
+    size_t capacityBytes() const {
+      size_t ret = blocks.capacity() * sizeof(vector<Node<LAZY>>);
+      for (auto &&b : blocks) ret += b.capacity() * sizeof(Node<LAZY>);
+      return ret;
+    }
+  };
+  IndexType N; vector<int> roots; vector<bool> alive; NodePool TR;
   int makeNode(int cp, IndexType tl, IndexType tr) {
     if (~cp) TR.push_back(TR[cp]);
     else TR.emplace_back(C::getSegmentVdef(tr - tl + 1));
@@ -196,20 +250,33 @@ struct DynamicSegmentTree {
     int nl = bsearchSuffix(TR[x].l, tl, m, l, r, agg, f, ret);
     TR[x].l = nl; return x;
   }
+  void mark(vector<int> &seen, int rootInd, int &cnt) {
+    vector<int> stk; if (alive[rootInd] && ~roots[rootInd]) {
+      stk.push_back(roots[rootInd]);
+    }
+    while (!stk.empty()) {
+      int x = stk.back(); stk.pop_back(); if (seen[x]) continue;
+      seen[x] = 1; cnt++; if (~TR[x].l) stk.push_back(TR[x].l);
+      if (~TR[x].r) stk.push_back(TR[x].r);
+    }
+  }
   DynamicSegmentTree(const vector<Data> &A) : N(A.size()) {
     if (N > 0) {
       reserveNodes(N * 2 - 1); roots.push_back(build(A, 0, N - 1));
+      alive.push_back(true);
     }
   }
-  DynamicSegmentTree(IndexType N) : N(N) { roots.push_back(-1); }
+  DynamicSegmentTree(IndexType N) : N(N) {
+    roots.push_back(-1); alive.push_back(true);
+  }
   lazy_def update(IndexType l, IndexType r, const Lazy &v, bool newRoot) {
     int nr = update(roots.back(), 0, N - 1, l, r, v, TR.size());
-    if (newRoot) roots.push_back(nr);
+    if (newRoot) { roots.push_back(nr); alive.push_back(true); }
     else roots.back() = nr;
   }
   void update(IndexType i, const Lazy &v, bool newRoot) {
     int nr = update(roots.back(), 0, N - 1, i, i, v, TR.size());
-    if (newRoot) roots.push_back(nr);
+    if (newRoot) { roots.push_back(nr); alive.push_back(true); }
     else roots.back() = nr;
   }
   Data query(IndexType l, IndexType r, int rootInd = -1) {
@@ -229,8 +296,40 @@ struct DynamicSegmentTree {
     root = bsearchSuffix(root, 0, N - 1, l, r, agg, f, ret);
     return ret;
   }
-  void revert(int rootInd) { roots.push_back(roots[rootInd]); }
+  void revert(int rootInd) {
+    roots.push_back(roots[rootInd]); alive.push_back(true);
+  }
   void reserveNodes(int k) { TR.reserve(k); }
+  void release(int rootInd) {
+    assert(rootInd != int(roots.size()) - 1); alive[rootInd] = false;
+  }
+  void collect() {
+    int S = TR.size(), cnt = 0, k = 0; vector<int> fwd(S, 0);
+    for (int i = 0; i < int(roots.size()); i++) mark(fwd, i, cnt);
+    for (int x = 0; x < S; x++) fwd[x] = fwd[x] ? k++ : -1;
+    for (int x = 0; x < S; x++) if (~fwd[x]) {
+      Node<LAZY> y = TR[x]; if (~y.l) y.l = fwd[y.l];
+      if (~y.r) y.r = fwd[y.r];
+      TR[fwd[x]] = y;
+    }
+    TR.shrink(k); for (int i = 0; i < int(roots.size()); i++)
+      roots[i] = alive[i] && ~roots[i] ? fwd[roots[i]] : -1;
+  }
+  int nodeCount() const { return TR.size(); }
+  size_t memoryUsage() const {
+    return sizeof(*this) + TR.capacityBytes() + roots.capacity() * sizeof(int)
+        + alive.capacity() / 8;
+  }
+  int versionNodes(int rootInd) {
+    vector<int> seen(TR.size(), 0); int cnt = 0;
+    mark(seen, rootInd, cnt); return cnt;
+  }
+  int retainedNodes(int rootInd) {
+    vector<int> seen(TR.size(), 0); int cnt = 0;
+    for (int i = 0; i < int(roots.size()); i++) if (i != rootInd)
+      mark(seen, i, cnt);
+    cnt = 0; mark(seen, rootInd, cnt); return cnt;
+  }
 #undef lazy_def
 #undef agg_def
 };
@@ -150,3 +150,200 @@ template <class C> struct SegmentTreeBeats {
     Data agg = C::qdef(); return bsearchSuffix(1, 0, N - 1, l, r, agg, f);
   }
 };
+
+// Top down segment tree beats supporting range add, range chmin, and range
+//   chmax updates, and range sum, minimum, maximum, historic sum, historic
+//   minimum, and historic maximum queries
+// After each update, B[i] is incremented by A[i] for all i, and the historic
+//   sum of a range is the sum of B[i] over that range, while the historic
+//   maximum (or minimum) of a range is the largest (or smallest) value that
+//   any A[i] in that range has had, including the initial values
+// The elements of each node are split into 3 groups: the elements equal to
+//   the maximum, the elements equal to the minimum, and all other elements,
+//   where each group has its own lazy tag made of the total added value, and
+//   the largest and smallest prefix of the added values, which compose
+//   associatively
+// Instead of B[i], each element keeps B[i] - t A[i] where t is the number of
+//   updates so far, which does not change when t increases, so an addition
+//   of v to A[i] at time t is an addition of -t v to this value, which is
+//   accumulated in the same lazy tags
+// The nodes are split into two arrays by how they are accessed: the values
+//   read by the pruning checks of chmin and chmax and by the merges are
+//   stored in one array with 48 bytes per node when T is 64 bits, and the
+//   historic values and the lazy tags, which are only needed by a push down,
+//   are stored in another array, so a push down touches about 10 cache lines
+//   and the pruning checks touch 1 or 2, while a separate array for each
+//   field would touch more than 30 cache lines for each push down
+// Indices are 0-indexed and ranges are inclusive
+// Template Arguments:
+//   T: the type of each element, must be large enough to hold the historic
+//     sums, and t times the values
+// Constructor Arguments:
+//   N: the size of the array
+//   A: a vector of type T
+// Fields:
+//   N: the size of the array
+//   t: the number of updates so far
+// Functions:
+//   add(l, r, v): adds v to A[i] for all i in the range [l, r]
+//   chmin(l, r, v): sets A[i] to min(A[i], v) for all i in the range [l, r]
+//   chmax(l, r, v): sets A[i] to max(A[i], v) for all i in the range [l, r]
+//   querySum(l, r): returns the sum of A[i] in the range [l, r]
+//   queryMax(l, r): returns the maximum of A[i] in the range [l, r]
+//   queryMin(l, r): returns the minimum of A[i] in the range [l, r]
+//   queryHistoricSum(l, r): returns the sum of B[i] in the range [l, r]
+//   queryHistoricMax(l, r): returns the largest value any A[i] in the range
+//     [l, r] has had
+//   queryHistoricMin(l, r): returns the smallest value any A[i] in the range
+//     [l, r] has had
+// In practice, has a moderate constant, and takes about twice as long as
+//   SegmentTreeBeats with the same updates without historic tags
+// Time Complexity:
+//   constructor: O(N)
+//   add, chmin, chmax: O((log N)^2) amortized
+//   querySum, queryMax, queryMin: O(log N)
+//   queryHistoricSum, queryHistoricMax, queryHistoricMin: O(log N)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz and Stress Tested
+template <class T> struct SegmentTreeBeatsHistoric {
+  struct Tag {
+    T a, hx, hn, s;
+    Tag(T a = T(), T hx = T(), T hn = T(), T s = T())
+        : a(a), hx(hx), hn(hn), s(s) {}
+    void compose(const Tag &v) {
+      hx = max(hx, a + v.hx); hn = min(hn, a + v.hn); s += v.s; a += v.a;
+    }
+  };
+  struct Val { T sm, mx, mx2, mn, mn2; int cmx, cmn; };
+  struct Hist { T hx, hn, hs; Tag lz[3]; bool d; };
+  int N; T t, NEG, POS; vector<Val> V; vector<Hist> H;
+  Tag addTag(T v) { return Tag(v, max(v, T()), min(v, T()), -t * v); }
+  void apply(int x, int k, const Tag &M, const Tag &L, const Tag &O) {
+    Val &v = V[x]; Hist &h = H[x]; h.d = true; if (v.mx == v.mn) {
+      h.hs += M.s * T(k); h.hx = max(h.hx, v.mx + M.hx);
+      h.hn = min(h.hn, v.mn + M.hn); v.mn = v.mx += M.a; v.sm += M.a * T(k);
+      h.lz[0].compose(M); h.lz[1].compose(M); h.lz[2].compose(O); return;
+    }
+    int co = k - v.cmx - v.cmn;
+    h.hs += M.s * T(v.cmx) + L.s * T(v.cmn) + O.s * T(co);
+    h.hx = max(h.hx, max(v.mx + M.hx, v.mn + L.hx));
+    h.hn = min(h.hn, min(v.mx + M.hn, v.mn + L.hn));
+    if (co > 0) {
+      h.hx = max(h.hx, v.mx2 + O.hx); h.hn = min(h.hn, v.mn2 + O.hn);
+    }
+    v.sm += M.a * T(v.cmx) + L.a * T(v.cmn) + O.a * T(co);
+    v.mx2 += v.mx2 == v.mn ? L.a : O.a; v.mn2 += v.mn2 == v.mx ? M.a : O.a;
+    v.mx += M.a; v.mn += L.a;
+    h.lz[0].compose(M); h.lz[1].compose(L); h.lz[2].compose(O);
+  }
+  void propagate(int x, int tl, int tr) {
+    if (!H[x].d) return;
+    int m = tl + (tr - tl) / 2, c = x * 2, len[2] = {m - tl + 1, tr - m};
+    T mx = max(V[c].mx, V[c + 1].mx), mn = min(V[c].mn, V[c + 1].mn);
+    Tag M = H[x].lz[0], L = H[x].lz[1], O = H[x].lz[2];
+    for (int j = 0; j < 2; j++, c++) {
+      bool one = V[c].mx == V[c].mn;
+      apply(c, len[j], V[c].mx == mx ? M : one && V[c].mn == mn ? L : O,
+            V[c].mn == mn ? L : O, O);
+    }
+    for (int g = 0; g < 3; g++) H[x].lz[g] = Tag();
+    H[x].d = false;
+  }
+  void pull(int x) {
+    const Val &l = V[x * 2], &r = V[x * 2 + 1]; Val &v = V[x];
+    const Hist &hl = H[x * 2], &hr = H[x * 2 + 1]; Hist &h = H[x];
+    v.sm = l.sm + r.sm; h.hs = hl.hs + hr.hs;
+    h.hx = max(hl.hx, hr.hx); h.hn = min(hl.hn, hr.hn);
+    const Val &a = l.mx < r.mx ? r : l, &b = l.mx < r.mx ? l : r;
+    v.mx = a.mx; v.cmx = a.cmx; if (a.mx == b.mx) {
+      v.cmx += b.cmx; v.mx2 = max(a.mx2, b.mx2);
+    } else v.mx2 = max(a.mx2, b.mx);
+    const Val &c = l.mn > r.mn ? r : l, &d = l.mn > r.mn ? l : r;
+    v.mn = c.mn; v.cmn = c.cmn; if (c.mn == d.mn) {
+      v.cmn += d.cmn; v.mn2 = min(c.mn2, d.mn2);
+    } else v.mn2 = min(c.mn2, d.mn);
+  }
+  void build(const vector<T> &A, int x, int tl, int tr) {
+    if (tl == tr) {
+      V[x].sm = V[x].mx = V[x].mn = H[x].hx = H[x].hn = A[tl];
+      V[x].mx2 = NEG; V[x].mn2 = POS; V[x].cmx = V[x].cmn = 1; return;
+    }
+    int m = tl + (tr - tl) / 2;
+    build(A, x * 2, tl, m); build(A, x * 2 + 1, m + 1, tr); pull(x);
+  }
+  template <class F>
+  void update(int x, int tl, int tr, int l, int r, T v, F f) {
+    if (r < tl || tr < l || f(x, tr - tl + 1, l <= tl && tr <= r, v)) return;
+    propagate(x, tl, tr); int m = tl + (tr - tl) / 2;
+    update(x * 2, tl, m, l, r, v, f); update(x * 2 + 1, m + 1, tr, l, r, v, f);
+    pull(x);
+  }
+  template <class G, class Op>
+  T query(G get, T qdef, Op op, int x, int tl, int tr, int l, int r) {
+    if (r < tl || tr < l) return qdef;
+    if (l <= tl && tr <= r) return get(x);
+    propagate(x, tl, tr); int m = tl + (tr - tl) / 2;
+    return op(query(get, qdef, op, x * 2, tl, m, l, r),
+              query(get, qdef, op, x * 2 + 1, m + 1, tr, l, r));
+  }
+  template <class F> void update(int l, int r, T v, F f) {
+    update(1, 0, N - 1, l, r, v, f); t += T(1);
+  }
+  static T maxOp(T a, T b) { return max(a, b); }
+  static T minOp(T a, T b) { return min(a, b); }
+  SegmentTreeBeatsHistoric(int N)
+      : SegmentTreeBeatsHistoric(vector<T>(N, T())) {}
+  SegmentTreeBeatsHistoric(const vector<T> &A)
+      : N(A.size()), t(), NEG(numeric_limits<T>::lowest()),
+        POS(numeric_limits<T>::max()) {
+    int S = N == 0 ? 0 : 1 << __lg(N * 4 - 1);
+    V.assign(S, Val()); H.assign(S, Hist());
+    if (N > 0) build(A, 1, 0, N - 1);
+  }
+  void add(int l, int r, T v) {
+    update(l, r, v, [&] (int x, int k, bool in, T w) {
+      if (!in) return false;
+      Tag g = addTag(w); apply(x, k, g, g, g); return true;
+    });
+  }
+  void chmin(int l, int r, T v) {
+    update(l, r, v, [&] (int x, int k, bool in, T w) {
+      if (V[x].mx <= w) return true;
+      if (!in || V[x].mx2 >= w) return false;
+      apply(x, k, addTag(w - V[x].mx), Tag(), Tag()); return true;
+    });
+  }
+  void chmax(int l, int r, T v) {
+    update(l, r, v, [&] (int x, int k, bool in, T w) {
+      if (V[x].mn >= w) return true;
+      if (!in || V[x].mn2 <= w) return false;
+      Tag g = addTag(w - V[x].mn);
+      apply(x, k, V[x].mx == V[x].mn ? g : Tag(), g, Tag()); return true;
+    });
+  }
+  T querySum(int l, int r) {
+    return query([&] (int x) { return V[x].sm; }, T(), plus<T>(), 1, 0,
+                 N - 1, l, r);
+  }
+  T queryMax(int l, int r) {
+    return query([&] (int x) { return V[x].mx; }, NEG, maxOp, 1, 0, N - 1,
+                 l, r);
+  }
+  T queryMin(int l, int r) {
+    return query([&] (int x) { return V[x].mn; }, POS, minOp, 1, 0, N - 1,
+                 l, r);
+  }
+  T queryHistoricSum(int l, int r) {
+    return query([&] (int x) { return H[x].hs; }, T(), plus<T>(), 1, 0,
+                 N - 1, l, r) + t * querySum(l, r);
+  }
+  T queryHistoricMax(int l, int r) {
+    return query([&] (int x) { return H[x].hx; }, NEG, maxOp, 1, 0, N - 1,
+                 l, r);
+  }
+  T queryHistoricMin(int l, int r) {
+    return query([&] (int x) { return H[x].hn; }, POS, minOp, 1, 0, N - 1,
+                 l, r);
+  }
+};
@@ -34,11 +34,19 @@ using namespace std;
 // Functions:
 //   update(i, v): updates the index i with the lazy value v
 //   query(l, r): queries the range [l, r] and returns the aggregate value
+//   maxRight(l, f): returns the largest r in the range [l - 1, N - 1] such
+//     that f(query(l, r)) returns true, where f(C::qdef()) must return true
+//     and f must be monotone, by descending from the nodes that query(l,
+//     N - 1) would visit
+//   minLeft(r, f): returns the smallest l in the range [0, r + 1] such that
+//     f(query(l, r)) returns true, where f(C::qdef()) must return true and
+//     f must be monotone, by descending from the nodes that query(0, r)
+//     would visit
 // In practice, has a small constant, not quite as fast as fenwick trees,
 //   but faster than top down segment trees
 // Time Complexity:
 //   constructor: O(N)
-//   update, query: O(log N)
+//   update, query, maxRight, minLeft: O(log N)
 // Memory Complexity: O(N)
 // Tested:
 //   https://dmoj.ca/problem/ds3
@@ -65,4 +73,38 @@ template <class C> struct SegmentTreeBottomUp {
     }
     return C::merge(ql, qr);
   }
+  template <class F> int maxRight(int l, F f) {
+    int nodes[64], rs[32], k = 0, m = 0; Data agg = C::qdef();
+    for (int a = l + N, b = N * 2 - 1; a <= b; a /= 2, b /= 2) {
+      if (a % 2) nodes[k++] = a++;
+      if (!(b % 2)) rs[m++] = b--;
+    }
+    while (m > 0) nodes[k++] = rs[--m];
+    for (int t = 0; t < k; t++) {
+      int i = nodes[t]; Data v = C::merge(agg, TR[i]);
+      if (f(v)) { agg = v; continue; }
+      while (i < N) {
+        v = C::merge(agg, TR[i *= 2]); if (f(v)) { agg = v; i++; }
+      }
+      return i - N - 1;
+    }
+    return N - 1;
+  }
+  template <class F> int minLeft(int r, F f) {
+    int nodes[64], ls[32], k = 0, m = 0; Data agg = C::qdef();
+    for (int a = N, b = r + N; a <= b; a /= 2, b /= 2) {
+      if (a % 2) ls[m++] = a++;
+      if (!(b % 2)) nodes[k++] = b--;
+    }
+    while (m > 0) nodes[k++] = ls[--m];
+    for (int t = 0; t < k; t++) {
+      int i = nodes[t]; Data v = C::merge(TR[i], agg);
+      if (f(v)) { agg = v; continue; }
+      while (i < N) {
+        v = C::merge(TR[i = i * 2 + 1], agg); if (f(v)) { agg = v; i--; }
+      }
+      return i - N + 1;
+    }
+    return 0;
+  }
 };
@@ -37,12 +37,33 @@ using namespace std;
 // Functions:
 //   update(l, r, v): update the range [l, r] with the lazy value v
 //   query(l, r): queries the range [l, r] and returns the aggregate value
+//   maxRight(l, f): returns the largest r in the range [l - 1, N - 1] such
+//     that f(query(l, r)) returns true, where f(C::qdef()) must return true
+//     and f must be monotone, by descending from the nodes that query(l,
+//     N - 1) would visit while pushing down the lazy values
+//   minLeft(r, f): returns the smallest l in the range [0, r + 1] such that
+//     f(query(l, r)) returns true, where f(C::qdef()) must return true and
+//     f must be monotone, by descending from the nodes that query(0, r)
+//     would visit while pushing down the lazy values
+//   batch(ops): applies the operations in ops in order, where each
+//     operation is a BatchOp with isUpdate, l, r, and v, and returns a
+//     vector of the results of the queries in order; the endpoints of the
+//     operations cut the array into K pieces, the lazy values of the
+//     ancestors of the cuts are pushed down once per level from the root,
+//     the operations are applied to a tree over the pieces, the combined
+//     lazy value of each piece is applied to its nodes, and the ancestors of
+//     the cuts are recomputed once per level from the leaves; falls back to
+//     applying the operations one at a time if 4K > Q, as the sweeps then
+//     cost more than they save, which is detected while inserting the
+//     distinct endpoints into a hash table of size O(Q) before anything is
+//     sorted
 // In practice, has a small constant, not quite as fast as fenwick trees,
 //   and similar performance as top down segment trees
 // Time Complexity:
 //   constructor: O(N)
-//   update, query: O(log N)
-// Memory Complexity: O(N)
+//   update, query, maxRight, minLeft: O(log N)
+//   batch: O(Q + K log N + Q log K) expected for Q operations with K pieces
+// Memory Complexity: O(N + Q log N)
 // Tested:
 //   https://dmoj.ca/problem/lazy
 //   https://mcpt.ca/problem/seq3
@@ -50,6 +71,22 @@ using namespace std;
 //   https://dmoj.ca/problem/dmopc17c4p6
 template <class C> struct SegmentTreeLazyBottomUp {
   using Data = typename C::Data; using Lazy = typename C::Lazy;
+  struct BatchOp { bool isUpdate; int l, r; Lazy v; };
+  struct BatchC {
+    using Lazy = typename C::Lazy;
+    struct Data { typename C::Data d; int len; Lazy lz; };
+    static Data qdef() { return Data{C::qdef(), 0, C::ldef()}; }
+    static Lazy ldef() { return C::ldef(); }
+    static Data merge(const Data &l, const Data &r) {
+      return Data{C::merge(l.d, r.d), l.len + r.len, C::ldef()};
+    }
+    static Data applyLazy(const Data &l, const Lazy &r, int) {
+      return Data{C::applyLazy(l.d, r, l.len), l.len, C::mergeLazy(l.lz, r)};
+    }
+    static Lazy mergeLazy(const Lazy &l, const Lazy &r) {
+      return C::mergeLazy(l, r);
+    }
+  };
   int N, lgN; vector<Data> TR; vector<Lazy> LZ;
   void apply(int i, const Lazy &v, int k) {
     TR[i] = C::applyLazy(TR[i], v, k);
@@ -59,6 +96,12 @@ template <class C> struct SegmentTreeLazyBottomUp {
     TR[i] = C::merge(TR[i * 2], TR[i * 2 + 1]);
     if (LZ[i] != C::ldef()) TR[i] = C::applyLazy(TR[i], LZ[i], k);
   }
+  void pushDown(int i, int k) {
+    if (LZ[i] != C::ldef()) {
+      apply(i * 2, LZ[i], k / 2); apply(i * 2 + 1, LZ[i], k / 2);
+      LZ[i] = C::ldef();
+    }
+  }
   void propagate(int i) {
     int h = lgN + 1, k = 1 << lgN, ii = i >> h;
     for (; h > 0; ii = i >> --h, k /= 2) if (LZ[ii] != C::ldef()) {
@@ -95,4 +138,109 @@ template <class C> struct SegmentTreeLazyBottomUp {
     }
     return C::merge(ql, qr);
   }
+  vector<Data> batch(const vector<BatchOp> &ops) {
+    int Q = ops.size(), H = 16; vector<int> cuts; vector<Data> ret;
+    while (H < Q / 2 + 8) H *= 2;
+    int lg = __lg(H); vector<int> key(H, -1), rnk(H);
+    auto slot = [&] (int x) {
+      int j = int((uint32_t(x) * 2654435769u) >> (32 - lg));
+      while (key[j] != -1 && key[j] != x) j = (j + 1) & (H - 1);
+      return j;
+    };
+    for (int i = 0; i < Q && (int(cuts.size()) - 1) * 4 <= Q; i++)
+      for (int x : {ops[i].l, ops[i].r + 1}) {
+        int j = slot(x); if (key[j] == -1) { key[j] = x; cuts.push_back(x); }
+      }
+    int K = int(cuts.size()) - 1; if (K <= 0 || K * 4 > Q) {
+      for (auto &&o : ops) {
+        if (o.isUpdate) update(o.l, o.r, o.v);
+        else ret.push_back(query(o.l, o.r));
+      }
+      return ret;
+    }
+    sort(cuts.begin(), cuts.end());
+    for (int p = 0; p <= K; p++) rnk[slot(cuts[p])] = p;
+    vector<pair<int, int>> nodes; vector<int> st(1, 0);
+    for (int p = 0; p < K; p++) for (int x : {cuts[p], cuts[p + 1] - 1})
+      if ((x + N) / 2 > 0
+          && (nodes.empty() || nodes.back().first != (x + N) / 2))
+        nodes.emplace_back((x + N) / 2, 2);
+    for (int s = 0, e = nodes.size(); s < e; s = e, e = nodes.size()) {
+      st.push_back(e); for (int j = s; j < e; j++) if (nodes[j].first > 1
+          && nodes.back().first != nodes[j].first / 2)
+        nodes.emplace_back(nodes[j].first / 2, nodes[j].second * 2);
+    }
+    for (int h = int(st.size()) - 2; h >= 0; h--)
+      for (int j = st[h]; j < st[h + 1]; j++)
+        pushDown(nodes[j].first, nodes[j].second);
+    vector<typename BatchC::Data> P(K);
+    for (int p = 0; p < K; p++) {
+      Data ql = C::qdef(), qr = C::qdef();
+      for (int l = cuts[p] + N, r = cuts[p + 1] - 1 + N; l <= r;
+           l /= 2, r /= 2) {
+        if (l % 2) ql = C::merge(ql, TR[l++]);
+        if (!(r % 2)) qr = C::merge(TR[r--], qr);
+      }
+      P[p] = typename BatchC::Data{C::merge(ql, qr), cuts[p + 1] - cuts[p],
+                                   C::ldef()};
+    }
+    SegmentTreeLazyBottomUp<BatchC> S(move(P)); for (int i = 0; i < Q; i++) {
+      int l = rnk[slot(ops[i].l)], r = rnk[slot(ops[i].r + 1)] - 1;
+      if (ops[i].isUpdate) S.update(l, r, ops[i].v);
+      else ret.push_back(S.query(l, r).d);
+    }
+    for (int i = 1; i < K; i++) S.pushDown(i, 2);
+    for (int p = 0; p < K; p++) if (S.TR[K + p].lz != C::ldef()) {
+      Lazy v = S.TR[K + p].lz;
+      for (int l = cuts[p] + N, r = cuts[p + 1] - 1 + N, k = 1; l <= r;
+           l /= 2, r /= 2, k *= 2) {
+        if (l % 2) apply(l++, v, k);
+        if (!(r % 2)) apply(r--, v, k);
+      }
+    }
+    for (int h = 0; h + 1 < int(st.size()); h++)
+      for (int j = st[h + 1] - 1; j >= st[h]; j--)
+        eval(nodes[j].first, nodes[j].second);
+    return ret;
+  }
+  template <class F> int maxRight(int l, F f) {
+    if (l >= N) return N - 1;
+    propagate(l + N); propagate(N * 2 - 1); Data agg = C::qdef();
+    int nodes[64], ks[64], rs[32], rk[32], k = 0, m = 0, sz = 1;
+    for (int a = l + N, b = N * 2 - 1; a <= b; a /= 2, b /= 2, sz *= 2) {
+      if (a % 2) { ks[k] = sz; nodes[k++] = a++; }
+      if (!(b % 2)) { rk[m] = sz; rs[m++] = b--; }
+    }
+    for (; m > 0; k++) { m--; ks[k] = rk[m]; nodes[k] = rs[m]; }
+    for (int t = 0; t < k; t++) {
+      int i = nodes[t]; Data v = C::merge(agg, TR[i]);
+      if (f(v)) { agg = v; continue; }
+      for (int s = ks[t]; i < N; s /= 2) {
+        pushDown(i, s); v = C::merge(agg, TR[i *= 2]);
+        if (f(v)) { agg = v; i++; }
+      }
+      return i - N - 1;
+    }
+    return N - 1;
+  }
+  template <class F> int minLeft(int r, F f) {
+    if (r < 0) return 0;
+    propagate(N); propagate(r + N); Data agg = C::qdef();
+    int nodes[64], ks[64], ls[32], lk[32], k = 0, m = 0, sz = 1;
+    for (int a = N, b = r + N; a <= b; a /= 2, b /= 2, sz *= 2) {
+      if (a % 2) { lk[m] = sz; ls[m++] = a++; }
+      if (!(b % 2)) { ks[k] = sz; nodes[k++] = b--; }
+    }
+    for (; m > 0; k++) { m--; ks[k] = lk[m]; nodes[k] = ls[m]; }
+    for (int t = 0; t < k; t++) {
+      int i = nodes[t]; Data v = C::merge(TR[i], agg);
+      if (f(v)) { agg = v; continue; }
+      for (int s = ks[t]; i < N; s /= 2) {
+        pushDown(i, s); v = C::merge(TR[i = i * 2 + 1], agg);
+        if (f(v)) { agg = v; i--; }
+      }
+      return i - N + 1;
+    }
+    return 0;
+  }
 };
@@ -0,0 +1,127 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Static B-ary search tree layout (similar to a B-tree) supporting point
+//   updates, prefix queries, and searches over the prefixes of a cumulative
+//   function or functor, such as sum
+// Each node stores B values in a block aligned to B * sizeof(T) bytes if
+//   possible (a copied tree realigns its own buffer), where the nodes at the
+//   bottom level store the prefixes of their B elements, and the nodes at
+//   every other level store the prefixes of their first j children for each
+//   j in the range [0, B), so a prefix query reads exactly one value from
+//   each level, and a search reads one node from each level and compares all
+//   B values in a loop without branches that can be vectorized
+// Indices are 0-indexed and ranges are inclusive
+// Template Arguments:
+//   T: the type of each element
+//   B: the number of children of each node, must be a power of 2
+//   Op: a struct with the cumulative operation (plus<T> by default)
+//     Required Functions:
+//       operator (l, r): combines the values l and r, must be associative and
+//         commutative
+// Constructor Arguments:
+//   N: the size of the array
+//   A: a vector of type T
+//   qdef: the identity element of the operation
+//   op: an instance of the Op struct
+// Fields:
+//   N: the size of the array
+//   H: the number of levels
+// Functions:
+//   update(i, v): modifies the value A[i] to op(A[i], v)
+//   query(r): queries the cumulative value of the range [0, r]
+//   query(l, r, inv): queries the cumulative value of the range [l, r], where
+//     inv is the inverse of op (minus<T>() by default)
+//   bsearch(v, cmp): returns the first index where cmp(op(A[0..i]), v)
+//     returns false, or N if no such index exists, where cmp(op(A[0..i]), v)
+//     must be monotone in i (less<T>() by default)
+// In practice, has a small constant, and a query or search on 10^7 elements
+//   with B = 8 or B = 16 touches about 6 to 8 cache lines instead of about
+//   24 for a binary tree, at the cost of O(B log_B N) updates
+// Time Complexity:
+//   constructor: O(N)
+//   update, bsearch: O(B log_B N)
+//   query: O(log_B N)
+// Memory Complexity: O(N + B log_B N)
+// Tested:
+//   Fuzz and Stress Tested
+template <class T, const int B = 16, class Op = plus<T>>
+struct SegmentTreeWide {
+  static_assert(B >= 2 && (B & (B - 1)) == 0, "B must be a power of 2");
+  static const int LGB = __builtin_ctz(B);
+  int N, H, S; vector<T> TR; vector<int> off; T qdef; Op op;
+  T *level(int h) { return TR.data() + off[h]; }
+  void realign() {
+    uintptr_t a = reinterpret_cast<uintptr_t>(TR.data());
+    int t = a % sizeof(T) != 0 ? 0 : int(a / sizeof(T) % B);
+    if (t > S) rotate(TR.begin(), TR.begin() + (t - S), TR.end());
+    else if (t < S) rotate(TR.begin(), TR.end() - (S - t), TR.end());
+    for (auto &&o : off) o += S - t;
+    S = t;
+  }
+  SegmentTreeWide(int N, T qdef = T(), Op op = Op())
+      : SegmentTreeWide(vector<T>(N, qdef), qdef, op) {}
+  SegmentTreeWide(const vector<T> &A, T qdef = T(), Op op = Op())
+      : N(A.size()), H(1), S(0), qdef(qdef), op(op) {
+    vector<T> cur = A; vector<int> len; int tot = B;
+    for (int n = N; n > B; H++) { n = (n + B - 1) / B; len.push_back(n); }
+    len.insert(len.begin(), N); for (int h = 0; h < H; h++) {
+      off.push_back(tot); tot += (len[h] + B - 1) / B * B;
+    }
+    TR.assign(tot, qdef); realign(); for (int h = 0; h < H; h++) {
+      T *p = level(h); vector<T> nxt;
+      for (int k = 0; k < len[h]; k += B) {
+        T agg = qdef; for (int j = k; j < k + B; j++) {
+          if (h > 0) p[j] = agg;
+          if (j < len[h]) agg = op(agg, cur[j]);
+          if (h == 0) p[j] = agg;
+        }
+        nxt.push_back(agg);
+      }
+      cur = move(nxt);
+    }
+  }
+  SegmentTreeWide(const SegmentTreeWide &o)
+      : N(o.N), H(o.H), S(o.S), TR(o.TR), off(o.off), qdef(o.qdef),
+        op(o.op) {
+    realign();
+  }
+  SegmentTreeWide(SegmentTreeWide &&o) = default;
+  SegmentTreeWide &operator = (const SegmentTreeWide &o) {
+    if (this != &o) {
+      N = o.N; H = o.H; S = o.S; TR = o.TR; off = o.off; qdef = o.qdef;
+      op = o.op; realign();
+    }
+    return *this;
+  }
+  SegmentTreeWide &operator = (SegmentTreeWide &&o) = default;
+  void update(int i, T v) {
+    T *p = level(0) + (i & -B); for (int j = i & (B - 1); j < B; j++)
+      p[j] = op(p[j], v);
+    for (int h = 1; h < H; h++) {
+      int k = i >> (h * LGB), j = k & (B - 1); p = level(h) + (k & -B);
+      for (int t = 0; t < B; t++) if (t > j) p[t] = op(p[t], v);
+    }
+  }
+  T query(int r) {
+    if (r < 0) return qdef;
+    T ret = level(0)[r]; for (int h = 1; h < H; h++)
+      ret = op(ret, level(h)[r >> (h * LGB)]);
+    return ret;
+  }
+  template <class Inv = minus<T>> T query(int l, int r, Inv inv = Inv()) {
+    return inv(query(r), query(l - 1));
+  }
+  template <class F = less<T>> int bsearch(T v, F cmp = F()) {
+    if (N == 0 || cmp(query(N - 1), v)) return N;
+    T agg = qdef; int k = 0; for (int h = H - 1; h > 0; h--) {
+      const T *p = level(h) + k * B; int c = 0;
+      for (int t = 1; t < B; t++) c += cmp(op(agg, p[t]), v);
+      agg = op(agg, p[c]); k = k * B + c;
+    }
+    const T *p = level(0) + k * B; int c = 0;
+    for (int t = 0; t < B; t++) c += cmp(op(agg, p[t]), v);
+    return k * B + c;
+  }
+};
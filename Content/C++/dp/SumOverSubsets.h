@@ -1,11 +1,14 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../math/FST.h"
 using namespace std;
 
 // Sum over subsets (or supersets) (similar to FST)
 // Transforms an array a into an array a' such that a'[i] is equal to the sum
 //   of all a[j] such that i | j == i if TYPE == SUBSET or i & j == i if
 //   TYPE == SUPERSET
+// Uses subsetTransform to process the low bits in L1 sized tiles with
+//   vectorized additions and to split the work between threads
 // Template Arguments:
 //   TYPE: SUBSET or SUPERSET
 //   T: the type of each element
@@ -13,16 +16,29 @@ using namespace std;
 //   a: a reference to the vector of type T to transform
 //   inv: a boolean indicating whether the inverse transform should be
 //     performed or not
+//   threads: the maximum number of threads to use
 // Time Complexity: O(N log N) where N = size(a)
 // Memory Complexity: O(1)
 // Tested:
 //   https://judge.yosupo.jp/problem/bitwise_and_convolution
 //   https://csacademy.com/contest/round-53/task/maxor/
 const bool SUBSET = true, SUPERSET = false;
-template <const bool TYPE, class T> void sos(vector<T> &a, bool inv) {
-  int N = a.size(); assert(!(N & (N - 1))); for (int m = 1; m < N; m <<= 1)
-    for (int mask = 0; mask < N; mask++) if (bool(mask & m) == TYPE) {
-      if (inv) a[mask] -= a[mask ^ m];
-      else a[mask] += a[mask ^ m];
-    }
+template <const bool TYPE, class T>
+void sos(vector<T> &a, bool inv, int threads = 1) {
+  int N = a.size(); assert(!(N & (N - 1))); if (N == 0) return;
+  if (TYPE == SUBSET) {
+    if (inv) subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      v -= u;
+    });
+    else subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      v += u;
+    });
+  } else {
+    if (inv) subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      u -= v;
+    });
+    else subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      u += v;
+    });
+  }
 }
@@ -0,0 +1,374 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "ModularArithmetic.h"
+#include "NTT.h"
+using namespace std;
+
+// Big Integer with 32-bit binary limbs
+// Multiplication uses schoolbook, Karatsuba, Toom-3, or NTT (over 16-bit
+//   digits with two primes) depending on the size, division uses
+//   schoolbook long division for small quotients and divisors and a Newton
+//   reciprocal otherwise, and decimal conversion is divide and conquer over
+//   cached powers 10^(9 * 2^i)
+// Constructor Arguments:
+//   s: a string of digits
+//   v: a long long
+// Functions:
+//   read(s): reads a BinaryBigInt from a string
+//   write(s): write a BinaryBigInt to a string
+//   >>, <<: input and output operators
+//   <, <=, >, >=, ==, !=: comparison operators
+//   isZero(): returns true if the big integer is 0
+//   abs(): returns the absolute value
+//   value(): returns the value as a long long, assuming it fits
+//   ++, --, +, +=, -, -=, *, *=, /, /=, %, %=: standard arithmetic operators
+//   divmod(a1, b1): returns a pair with the quotient and remainder of
+//     a1 divided by b1, rounded towards zero
+// In practice, has a moderate constant, multiplication and division of
+//   numbers with a million digits take a fraction of a second, and decimal
+//   conversion is a logarithmic factor slower
+// Time Complexity:
+//   constructor, read, write, >>, <<: O(M(N) log N)
+//   isZero: O(1)
+//   <, <=, >, >=, ==, !=, abs, ++, --, +, +=, -, -=: O(N)
+//   *, *=: O(M(N)) where M(N) = O(N log N) is the cost of multiplication
+//   /, /=, %, %=, divmod: O(M(N))
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+struct BinaryBigInt {
+  using Limbs = vector<uint32_t>;
+  static const int KARATSUBA_CUTOFF = 32, TOOM3_CUTOFF = 128;
+  static const int NTT_CUTOFF = 1536, NEWTON_CUTOFF = 64, DECIMAL_CUTOFF = 32;
+  Limbs a; int sign;
+  static void trim(Limbs &x) {
+    while (!x.empty() && x.back() == 0) x.pop_back();
+  }
+  static int cmp(const Limbs &x, const Limbs &y) {
+    if (x.size() != y.size()) return x.size() < y.size() ? -1 : 1;
+    for (int i = int(x.size()) - 1; i >= 0; i--)
+      if (x[i] != y[i]) return x[i] < y[i] ? -1 : 1;
+    return 0;
+  }
+  static void addTo(Limbs &x, const Limbs &y, int k = 0) {
+    if (x.size() < y.size() + k) x.resize(y.size() + k, 0);
+    uint64_t c = 0; int i = 0; for (; i < int(y.size()); i++) {
+      c += uint64_t(x[i + k]) + y[i]; x[i + k] = uint32_t(c); c >>= 32;
+    }
+    for (i += k; c > 0 && i < int(x.size()); i++) {
+      c += x[i]; x[i] = uint32_t(c); c >>= 32;
+    }
+    if (c > 0) x.push_back(uint32_t(c));
+  }
+  static void subFrom(Limbs &x, const Limbs &y, int k = 0) {
+    int64_t c = 0; int i = 0; for (; i < int(y.size()); i++) {
+      int64_t t = int64_t(x[i + k]) - y[i] - c; c = t < 0; x[i + k] = t;
+    }
+    for (i += k; c > 0; i++) {
+      int64_t t = int64_t(x[i]) - c; c = t < 0; x[i] = t;
+    }
+    trim(x);
+  }
+  static void mulSmall(Limbs &x, uint32_t m, uint32_t c = 0) {
+    uint64_t carry = c; for (auto &&xi : x) {
+      carry += uint64_t(xi) * m; xi = uint32_t(carry); carry >>= 32;
+    }
+    if (carry > 0) x.push_back(uint32_t(carry));
+    trim(x);
+  }
+  static uint32_t divSmall(Limbs &x, uint32_t d) {
+    uint64_t r = 0; for (int i = int(x.size()) - 1; i >= 0; i--) {
+      r = (r << 32) | x[i]; x[i] = uint32_t(r / d); r %= d;
+    }
+    trim(x); return uint32_t(r);
+  }
+  static Limbs slice(const Limbs &x, int lo, int hi) {
+    lo = min(lo, int(x.size())); hi = min(hi, int(x.size()));
+    Limbs ret(x.begin() + lo, x.begin() + hi); trim(ret); return ret;
+  }
+  static Limbs mulSchoolbook(const Limbs &x, const Limbs &y) {
+    Limbs r(x.size() + y.size(), 0); for (int i = 0; i < int(x.size()); i++) {
+      uint64_t c = 0; for (int j = 0; j < int(y.size()); j++) {
+        c += uint64_t(x[i]) * y[j] + r[i + j]; r[i + j] = uint32_t(c);
+        c >>= 32;
+      }
+      r[i + y.size()] = uint32_t(c);
+    }
+    trim(r); return r;
+  }
+  static Limbs mulKaratsuba(const Limbs &x, const Limbs &y) {
+    int k = (max(x.size(), y.size()) + 1) / 2;
+    Limbs x0 = slice(x, 0, k), x1 = slice(x, k, x.size());
+    Limbs y0 = slice(y, 0, k), y1 = slice(y, k, y.size());
+    Limbs z0 = mul(x0, y0), z2 = mul(x1, y1); addTo(x0, x1); addTo(y0, y1);
+    Limbs z1 = mul(x0, y0), r = z0; subFrom(z1, z0); subFrom(z1, z2);
+    addTo(r, z1, k); addTo(r, z2, k * 2); trim(r); return r;
+  }
+  static Limbs mulToom3(const Limbs &x, const Limbs &y) {
+    int k = (max(x.size(), y.size()) + 2) / 3; BinaryBigInt A[3], B[3];
+    for (int i = 0; i < 3; i++) {
+      A[i].a = slice(x, i * k, (i + 1) * k);
+      B[i].a = slice(y, i * k, (i + 1) * k);
+    }
+    BinaryBigInt pa = A[0] + A[2], pb = B[0] + B[2];
+    BinaryBigInt p1 = pa + A[1], q1 = pb + B[1], pm1 = pa - A[1];
+    BinaryBigInt qm1 = pb - B[1], pm2 = (pm1 + A[2]) * 2 - A[0];
+    BinaryBigInt qm2 = (qm1 + B[2]) * 2 - B[0], r0 = A[0] * B[0];
+    BinaryBigInt r1 = p1 * q1, rm1 = pm1 * qm1, r4 = A[2] * B[2];
+    BinaryBigInt r3 = (pm2 * qm2 - r1) / 3; r1 = (r1 - rm1) / 2;
+    BinaryBigInt r2 = rm1 - r0; r3 = (r2 - r3) / 2 + r4 * 2;
+    r2 = r2 + r1 - r4; r1 = r1 - r3; Limbs r = r0.a; addTo(r, r1.a, k);
+    addTo(r, r2.a, k * 2); addTo(r, r3.a, k * 3); addTo(r, r4.a, k * 4);
+    trim(r); return r;
+  }
+  static Limbs mulNTT(const Limbs &x, const Limbs &y) {
+    const uint32_t P1 = 167772161, P2 = 469762049; bool eq = &x == &y;
+    static const uint64_t I = mulInvModPrime(uint64_t(P1), uint64_t(P2));
+    auto split = [&] (const Limbs &v) {
+      vector<uint32_t> d(v.size() * 2);
+      for (int i = 0; i < int(v.size()); i++) {
+        d[i * 2] = v[i] & 0xFFFF; d[i * 2 + 1] = v[i] >> 16;
+      }
+      return d;
+    };
+    vector<uint32_t> dx = split(x), dy; if (!eq) dy = split(y);
+    int N = 1, D = (x.size() + y.size()) * 2;
+    while (N < D - 1) N <<= 1;
+    vector<uint32_t> r1 = cyclicConvMontgomery<P1>(dx, dy, N, eq);
+    vector<uint32_t> r2 = cyclicConvMontgomery<P2>(dx, dy, N, eq);
+    Limbs r(x.size() + y.size(), 0); uint64_t c = 0;
+    for (int i = 0; i < D; i++) {
+      if (i < N) {
+        uint64_t v1 = r1[i], v2 = (r2[i] + P2 - v1 % P2) * I % P2;
+        c += v1 + v2 * P1;
+      }
+      r[i / 2] |= uint32_t(c & 0xFFFF) << (16 * (i & 1)); c >>= 16;
+    }
+    trim(r); return r;
+  }
+  static Limbs mul(const Limbs &x, const Limbs &y) {
+    int n = x.size(), m = y.size(); if (n == 0 || m == 0) return Limbs();
+    if (n < m) return mul(y, x);
+    if (m < KARATSUBA_CUTOFF) return mulSchoolbook(x, y);
+    if (n >= m * 2 && m < NTT_CUTOFF) {
+      Limbs r; for (int i = 0; i < n; i += m)
+        addTo(r, mul(slice(x, i, i + m), y), i);
+      trim(r); return r;
+    }
+    if (m < TOOM3_CUTOFF) return mulKaratsuba(x, y);
+    if (m < NTT_CUTOFF) return mulToom3(x, y);
+    return mulNTT(x, y);
+  }
+  static Limbs divSchoolbook(const Limbs &u, const Limbs &v, Limbs &r) {
+    int n = u.size(), m = v.size();
+    if (cmp(u, v) < 0) { r = u; return Limbs(); }
+    if (m == 1) {
+      Limbs q = u; uint32_t rem = divSmall(q, v[0]);
+      r = rem == 0 ? Limbs() : Limbs(1, rem); return q;
+    }
+    int s = __builtin_clz(v.back()); Limbs vn(m), un(n + 1), q(n - m + 1);
+    for (int i = m - 1; i > 0; i--)
+      vn[i] = (v[i] << s) | uint32_t(uint64_t(v[i - 1]) >> (32 - s));
+    vn[0] = v[0] << s; un[n] = uint64_t(u[n - 1]) >> (32 - s);
+    for (int i = n - 1; i > 0; i--)
+      un[i] = (u[i] << s) | uint32_t(uint64_t(u[i - 1]) >> (32 - s));
+    un[0] = u[0] << s; for (int j = n - m; j >= 0; j--) {
+      uint64_t num = (uint64_t(un[j + m]) << 32) | un[j + m - 1];
+      uint64_t qh = num / vn[m - 1], rh = num % vn[m - 1];
+      while ((qh >> 32) > 0 || qh * vn[m - 2] > ((rh << 32) | un[j + m - 2])) {
+        qh--; rh += vn[m - 1]; if ((rh >> 32) > 0) break;
+      }
+      int64_t borrow = 0, t = 0; uint64_t carry = 0;
+      for (int i = 0; i < m; i++) {
+        uint64_t p = qh * vn[i] + carry; carry = p >> 32;
+        t = int64_t(un[i + j]) - borrow - int64_t(p & 0xFFFFFFFF);
+        un[i + j] = t; borrow = t < 0;
+      }
+      t = int64_t(un[j + m]) - borrow - int64_t(carry); un[j + m] = t;
+      q[j] = qh; if (t < 0) {
+        q[j]--; uint64_t c = 0; for (int i = 0; i < m; i++) {
+          c += uint64_t(un[i + j]) + vn[i]; un[i + j] = uint32_t(c); c >>= 32;
+        }
+        un[j + m] += uint32_t(c);
+      }
+    }
+    r.assign(m, 0); for (int i = 0; i < m; i++)
+      r[i] = (un[i] >> s) | uint32_t(uint64_t(un[i + 1]) << (32 - s));
+    trim(q); trim(r); return q;
+  }
+  static Limbs reciprocal(const Limbs &v, int k) {
+    int m = v.size();
+    if (m > k + 2) return reciprocal(slice(v, m - k - 2, m), k);
+    if (k <= NEWTON_CUTOFF) {
+      Limbs u(m + k + 1, 0), r; u.back() = 1; return divSchoolbook(u, v, r);
+    }
+    int h = k / 2 + 1; Limbs x = reciprocal(v, h), X(k - h, 0);
+    X.insert(X.end(), x.begin(), x.end()); Limbs t = mul(mul(X, X), v);
+    t.erase(t.begin(), t.begin() + min(int(t.size()), m + k));
+    Limbs r = X; addTo(r, X); if (cmp(r, t) <= 0) return Limbs();
+    subFrom(r, t); return r;
+  }
+  static Limbs divNewton(const Limbs &u, const Limbs &v, const Limbs &V,
+                         int k, Limbs &r) {
+    int s = max(0, int(u.size()) - k - 2), t = v.size() + k - s;
+    Limbs q = mul(slice(u, s, u.size()), V), one(1, 1);
+    q.erase(q.begin(), q.begin() + min(int(q.size()), t));
+    Limbs qv = mul(q, v);
+    while (cmp(qv, u) > 0) { subFrom(q, one); subFrom(qv, v); }
+    r = u; subFrom(r, qv);
+    while (cmp(r, v) >= 0) { addTo(q, one); subFrom(r, v); }
+    return q;
+  }
+  static Limbs divMod(const Limbs &u, const Limbs &v, Limbs &r) {
+    assert(!v.empty()); int n = u.size(), m = v.size();
+    if (cmp(u, v) < 0) { r = u; return Limbs(); }
+    if (m <= NEWTON_CUTOFF || n - m <= NEWTON_CUTOFF)
+      return divSchoolbook(u, v, r);
+    return divNewton(u, v, reciprocal(v, n - m), n - m, r);
+  }
+  static const Limbs &pow10(int i) {
+    thread_local vector<Limbs> P(1, Limbs(1, 1000000000));
+    while (int(P.size()) <= i) P.push_back(mul(P.back(), P.back()));
+    return P[i];
+  }
+  static const Limbs &pow10Inv(int i) {
+    thread_local vector<Limbs> V;
+    while (int(V.size()) <= i) {
+      const Limbs &P = pow10(V.size());
+      V.push_back(reciprocal(P, P.size() + 1));
+    }
+    return V[i];
+  }
+  static Limbs readRec(const string &s, int l, int r) {
+    if (r - l <= 9 * DECIMAL_CUTOFF) {
+      Limbs x; for (int i = l; i < r;) {
+        int len = i == l ? (r - l - 1) % 9 + 1 : 9; uint32_t c = 0, p = 1;
+        for (int j = 0; j < len; j++, i++) {
+          c = c * 10 + s[i] - '0'; p *= 10;
+        }
+        mulSmall(x, p, c);
+      }
+      return x;
+    }
+    int i = 0; while ((9 << (i + 1)) < r - l) i++;
+    int len = 9 << i; Limbs x = mul(readRec(s, l, r - len), pow10(i));
+    addTo(x, readRec(s, r - len, r)); trim(x); return x;
+  }
+  static void writeRec(const Limbs &x, int i, int pad, string &out) {
+    if (int(x.size()) <= DECIMAL_CUTOFF) {
+      Limbs t = x; vector<uint32_t> c; while (!t.empty())
+        c.push_back(divSmall(t, 1000000000));
+      string s = c.empty() ? "" : to_string(c.back());
+      for (int j = int(c.size()) - 2; j >= 0; j--) {
+        string d = to_string(c[j]); s += string(9 - d.size(), '0') + d;
+      }
+      if (int(s.size()) < pad) out.append(pad - s.size(), '0');
+      out += s; return;
+    }
+    const Limbs &P = pow10(i); Limbs r, q = int(P.size()) <= NEWTON_CUTOFF
+        ? divMod(x, P, r) : divNewton(x, P, pow10Inv(i), P.size() + 1, r);
+    int len = 9 << i;
+    if (q.empty() && pad == 0) { writeRec(r, i - 1, 0, out); return; }
+    writeRec(q, i - 1, max(0, pad - len), out); writeRec(r, i - 1, len, out);
+  }
+  void read(const string &s) {
+    sign = 1; int pos = 0;
+    for (; pos < int(s.size()) && (s[pos] == '-' || s[pos] == '+'); ++pos)
+      if (s[pos] == '-') sign = -sign;
+    while (pos < int(s.size()) && s[pos] == '0') pos++;
+    a = readRec(s, pos, s.size()); if (a.empty()) sign = 1;
+  }
+  friend istream& operator >> (istream &stream, BinaryBigInt &v) {
+    string s; stream >> s; v.read(s); return stream;
+  }
+  string write() const {
+    if (a.empty()) return "0";
+    string ret = sign == -1 ? "-" : ""; int i = 0;
+    while (cmp(pow10(i + 1), a) <= 0) i++;
+    writeRec(a, i, 0, ret); return ret;
+  }
+  friend ostream& operator << (ostream &stream, const BinaryBigInt &v) {
+    stream << v.write(); return stream;
+  }
+  bool operator < (const BinaryBigInt &v) const {
+    if (sign != v.sign) return sign < v.sign;
+    return sign == 1 ? cmp(a, v.a) < 0 : cmp(v.a, a) < 0;
+  }
+  bool operator <= (const BinaryBigInt &v) const { return !(v < *this); }
+  bool operator > (const BinaryBigInt &v) const { return v < *this; }
+  bool operator >= (const BinaryBigInt &v) const { return !(*this < v); }
+  bool operator == (const BinaryBigInt &v) const {
+    return sign == v.sign && a == v.a;
+  }
+  bool operator != (const BinaryBigInt &v) const { return !(*this == v); }
+  BinaryBigInt() : sign(1) {}
+  BinaryBigInt(const string &s) { read(s); }
+  BinaryBigInt(long long v) : sign(v < 0 ? -1 : 1) {
+    uint64_t x = v < 0 ? -uint64_t(v) : uint64_t(v);
+    for (; x > 0; x >>= 32) a.push_back(uint32_t(x));
+  }
+  bool isZero() const { return a.empty(); }
+  BinaryBigInt operator + () const { return *this; }
+  BinaryBigInt operator - () const {
+    BinaryBigInt res = *this; if (!a.empty()) res.sign = -sign;
+    return res;
+  }
+  BinaryBigInt abs() const {
+    BinaryBigInt res = *this; res.sign = 1; return res;
+  }
+  long long value() const {
+    uint64_t res = 0; for (int i = min(int(a.size()), 2) - 1; i >= 0; i--)
+      res = (res << 32) | a[i];
+    return sign == 1 ? (long long)(res) : (long long)(-res);
+  }
+  BinaryBigInt operator ++ () { return *this += BinaryBigInt(1); }
+  BinaryBigInt operator ++ (int) {
+    BinaryBigInt ret = *this; *this += BinaryBigInt(1); return ret;
+  }
+  BinaryBigInt operator -- () { return *this -= BinaryBigInt(1); }
+  BinaryBigInt operator -- (int) {
+    BinaryBigInt ret = *this; *this -= BinaryBigInt(1); return ret;
+  }
+  BinaryBigInt operator + (const BinaryBigInt &v) const {
+    BinaryBigInt res = *this;
+    if (sign == v.sign) { addTo(res.a, v.a); return res; }
+    if (cmp(a, v.a) >= 0) subFrom(res.a, v.a);
+    else { res.a = v.a; subFrom(res.a, a); res.sign = v.sign; }
+    if (res.a.empty()) res.sign = 1;
+    return res;
+  }
+  BinaryBigInt &operator += (const BinaryBigInt &v) {
+    return *this = *this + v;
+  }
+  BinaryBigInt operator - (const BinaryBigInt &v) const {
+    return *this + (-v);
+  }
+  BinaryBigInt &operator -= (const BinaryBigInt &v) {
+    return *this = *this - v;
+  }
+  BinaryBigInt operator * (const BinaryBigInt &v) const {
+    BinaryBigInt res; res.a = mul(a, v.a);
+    res.sign = res.a.empty() ? 1 : sign * v.sign; return res;
+  }
+  BinaryBigInt &operator *= (const BinaryBigInt &v) {
+    return *this = *this * v;
+  }
+  friend pair<BinaryBigInt, BinaryBigInt> divmod(const BinaryBigInt &a1,
+                                                 const BinaryBigInt &b1) {
+    BinaryBigInt q, r; q.a = divMod(a1.a, b1.a, r.a);
+    q.sign = q.a.empty() ? 1 : a1.sign * b1.sign;
+    r.sign = r.a.empty() ? 1 : a1.sign; return make_pair(q, r);
+  }
+  BinaryBigInt operator / (const BinaryBigInt &v) const {
+    return divmod(*this, v).first;
+  }
+  BinaryBigInt operator % (const BinaryBigInt &v) const {
+    return divmod(*this, v).second;
+  }
+  BinaryBigInt &operator /= (const BinaryBigInt &v) {
+    return *this = *this / v;
+  }
+  BinaryBigInt &operator %= (const BinaryBigInt &v) {
+    return *this = *this % v;
+  }
+};
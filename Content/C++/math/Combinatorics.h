@@ -211,6 +211,115 @@ template <class T> struct CombinatoricsModPrime {
   T multiChoose(int n, int k) { return choose(n + k - 1, k); }
 };
 
+// Lazily grown table of factorials and inverse factorials modulo a prime
+//   power P^E, answering queries in O(1) if all arguments are less than P,
+//   and falling back to Lucas's theorem if E is 1, or to Granville's
+//   generalization of it if E is greater than 1, otherwise
+// Index i of the table stores the product of all integers in the range
+//   [1, i] not divisible by P, which is i! for i < P, and the table is
+//   only grown when a query needs an index past its end, at least doubling
+//   its size each time, and never for a query whose answer is 0 because the
+//   power of P in it, found with Legendre's formula, is at least E
+// Template Arguments:
+//   T: the type of the values, must be a signed integral type
+// Constructor Arguments:
+//   P: the prime, where P^E * P^E must fit in T
+//   E: the exponent of the modulus, must be positive
+// Fields:
+//   P: the prime
+//   E: the exponent of the modulus
+//   M: the modulus P^E
+//   W: the product of all integers in the range [1, M) coprime with M,
+//     modulo M, which is 1 if P is 2 and E >= 3 and M - 1 otherwise
+//   fact: fact[i] is the product of all integers in the range [1, i] not
+//     divisible by P, modulo M
+//   invFact: invFact[i] is the multiplicative inverse of fact[i] modulo M
+// Functions:
+//   reserve(n): grows the table to cover all indices up to min(n, M - 1)
+//   factorial(n): returns n! modulo M for n >= 0
+//   invFactorial(n): returns the multiplicative inverse of n! modulo M
+//     for 0 <= n < P
+//   permute(n, k): returns n permute k (n! / (n - k)!) modulo M for n >= 0,
+//     or 0 if k < 0 or k > n
+//   choose(n, k): returns n choose k (n! / (k! (n - k)!)) modulo M for
+//     n >= 0, or 0 if k < 0 or k > n
+//   multiChoose(n, k): returns n multichoose k ((n + k - 1)! / (k! (n - 1)!))
+//     modulo M for n >= 1, k >= 0
+//   catalan(n): returns the nth Catalan number (2n choose n) / (n + 1)
+//     modulo M for n >= 0
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor: O(E)
+//   reserve: O(n + log M), amortized O(1) per new entry
+//   factorial, invFactorial, permute, choose, multiChoose, catalan: O(1)
+//     if all arguments are less than P, O(log n / log P) otherwise,
+//     excluding the growth of the table, which happens O(log min(n, M))
+//     times
+// Memory Complexity: O(min(n, M)) where n is the largest argument
+// Tested:
+//   Fuzz Tested
+template <class T> struct BinomialTable {
+  static_assert(is_integral<T>::value, "T must be an integral type");
+  static_assert(is_signed<T>::value, "T must be a signed type");
+  T P, M, W; int E; vector<T> fact, invFact;
+  BinomialTable(T P, int E = 1)
+      : P(P), M(1), E(E), fact(1, T(1)), invFact(1, T(1)) {
+    for (int i = 0; i < E; i++) M *= P;
+    W = P == 2 && E >= 3 ? T(1) : M - 1;
+  }
+  void reserve(T n) {
+    T N = fact.size(); if (n < N) return;
+    T old = N; N = min(max(n + 1, N * 2), M);
+    fact.resize(N); invFact.resize(N); for (T i = old; i < N; i++)
+      fact[i] = mulMod(fact[i - 1], i % P == 0 ? T(1) : i, M);
+    invFact[N - 1] = mulInv(fact[N - 1], M); for (T i = N - 1; i > old; i--)
+      invFact[i - 1] = mulMod(invFact[i], i % P == 0 ? T(1) : i, M);
+  }
+  T legendre(T n) { T ret = 0; while (n > 0) ret += n /= P; return ret; }
+  T unitFactorial(T n, bool inv) {
+    T ret = T(1); for (; n > 0; n /= P) {
+      T s = n % M; reserve(s); if ((n / M) % 2 == 1) ret = mulMod(ret, W, M);
+      ret = mulMod(ret, inv ? invFact[s] : fact[s], M);
+    }
+    return ret;
+  }
+  T withPower(T ret, T cnt) {
+    for (T i = 0; i < cnt; i++) ret = mulMod(ret, P, M);
+    return ret;
+  }
+  T factorial(T n) {
+    if (n < P) { reserve(n); return fact[n]; }
+    T cnt = legendre(n); if (cnt >= E) return T(0);
+    return withPower(unitFactorial(n, false), cnt);
+  }
+  T invFactorial(T n) { assert(n < P); reserve(n); return invFact[n]; }
+  T permute(T n, T k) {
+    if (k < 0 || k > n) return T(0);
+    if (n < P) { reserve(n); return mulMod(fact[n], invFact[n - k], M); }
+    T cnt = legendre(n) - legendre(n - k); if (cnt >= E) return T(0);
+    T ret = mulMod(unitFactorial(n, false), unitFactorial(n - k, true), M);
+    return withPower(ret, cnt);
+  }
+  T choose(T n, T k) {
+    if (k < 0 || k > n) return T(0);
+    if (n < P) {
+      reserve(n);
+      return mulMod(mulMod(fact[n], invFact[k], M), invFact[n - k], M);
+    }
+    if (E == 1) {
+      T ret = T(1); for (; n > 0 && ret != T(0); n /= P, k /= P)
+        ret = mulMod(ret, choose(n % P, k % P), M);
+      return ret;
+    }
+    T cnt = legendre(n) - legendre(k) - legendre(n - k);
+    if (cnt >= E) return T(0);
+    T ret = mulMod(unitFactorial(n, false), unitFactorial(k, true), M);
+    return withPower(mulMod(ret, unitFactorial(n - k, true), M), cnt);
+  }
+  T multiChoose(T n, T k) { return choose(n + k - 1, k); }
+  T catalan(T n) { return subMod(choose(n * 2, n), choose(n * 2, n + 1), M); }
+};
+
 // Computes a row of Pascal's triangle
 // Template Arguments:
 //   T: the type of the values in the row of Pascal's triangle
@@ -5,18 +5,20 @@ using namespace std;
 
 // Struct representing integers modulo MOD where MOD can change during runtime
 // Template Arguments:
-//   T: the type of the integer, must be integral
+//   T: the type of the integer, must be integral with at most 64 bits
 // Constructor Arguments:
 //   x: the value to initialize the struct with
 // Fields:
 //   static MOD: the value to mod by, must be non negative
 //   static PRIME_MOD: a boolean indicating whether MOD is prime
 //   static MUL_OVERFLOW: a boolean indicating whether MOD * MOD overflows
+//   static BARRETT: floor((2^64 - 1) / MOD), used to reduce products without
+//     a division if MUL_OVERFLOW is false
 //   v: the value
 // Functions:
-//   statis setMod(mod, primeMod, mulOverflow): sets the mod to MOD, with
+//   static setMod(mod, primeMod, mulOverflow): sets the mod to MOD, with
 //     primeMod indicating whether the mod is prime and mulOverflow indicating
-//     whether multiplication overflows
+//     whether multiplication overflows, and precomputes BARRETT
 //   <, <=, >, >=, ==, !=: comparison operators
 //   ++, --, +, +=, -, -=, *, *=: standard arithmetic operators modulo MOD
 //   pow(p): returns this value raises this to the power of p
@@ -30,19 +32,27 @@ using namespace std;
 //   constructor: O(1)
 //   setMod: O(1)
 //   <, <=, >, >=, ==, !=, ++, --, +, +=, -, -=, >>, <<: O(1)
-//   *, *=: O(1) if MUL_OVERFLOW is false, O(log MOD) otherwise
-//   pow: O(log MOD) if MUL_OVERFLOW is false, O((log MOD)^2) otherwise
+//   *, *=: O(1)
+//   pow: O(log MOD)
 //   hasMulInv, mulInv, /, /=: O(log MOD)
+// In practice, multiplication has a small constant, using Barrett reduction
+//   instead of a hardware division if MUL_OVERFLOW is false, and a single
+//   128-bit by 64-bit modulo otherwise
 // Memory Complexity: O(1)
 // Tested:
+//   Stress Tested
 //   https://open.kattis.com/problems/modulararithmetic
 template <class T> struct DynamicIntMod {
   static_assert(is_integral<T>::value, "T must be an integral type");
   static_assert(is_signed<T>::value, "T must be a signed type");
+  static_assert(sizeof(T) <= 8, "T must have at most 64 bits");
   using IM = DynamicIntMod<T>;
+  using u64 = uint64_t; using u128 = __uint128_t;
   static T MOD; static bool PRIME_MOD, MUL_OVERFLOW;
+  static u64 BARRETT;
   static void setMod(T mod, bool primeMod = false, bool mulOverflow = false) {
     MOD = mod; PRIME_MOD = primeMod; MUL_OVERFLOW = mulOverflow;
+    BARRETT = ~u64(0) / u64(mod);
   }
   T v; DynamicIntMod() : v(0) {}
   DynamicIntMod(const T &x) {
@@ -83,11 +93,10 @@ template <class T> struct DynamicIntMod {
   IM operator - () const { return IM(-v); }
   IM operator * (const IM &i) const { return IM(*this) *= i; }
   IM &operator *= (const IM &i) {
-    if (MUL_OVERFLOW) {
-      IM x = 0, y = *this; T z = i.v;
-      for (; z > 0; z /= 2, y += y) if (z % 2 == 1) x += y;
-      *this = x;
-    } else v = v * i.v % MOD;
+    if (!MUL_OVERFLOW) {
+      u64 x = u64(v) * u64(i.v), q = u128(x) * BARRETT >> 64;
+      x -= q * u64(MOD); v = x >= u64(MOD) ? x - u64(MOD) : x;
+    } else v = u128(v) * u64(i.v) % u64(MOD);
     return *this;
   }
   bool hasMulInv() const {
@@ -119,3 +128,4 @@ template <class T> struct DynamicIntMod {
 template <class T> T DynamicIntMod<T>::MOD = T(1);
 template <class T> bool DynamicIntMod<T>::PRIME_MOD = false;
 template <class T> bool DynamicIntMod<T>::MUL_OVERFLOW = false;
+template <class T> uint64_t DynamicIntMod<T>::BARRETT = ~uint64_t(0);
@@ -2,34 +2,70 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Precomputed roots of unity and bit reversal permutation for the Fast
+//   Fourier Transform of any power of 2 size up to N
+// Can be shared between threads as all functions are read only
+// Template Arguments:
+//   F: the floating point type of the complex number components
+// Constructor Arguments:
+//   N: the maximum size of the transform, must be a power of 2
+// Fields:
+//   N: the maximum size of the transform
+//   rt: the roots of unity, where rt[k + j] for 0 <= j < k is the j-th power
+//     of the 2k-th principal root of unity
+//   ord: the bit reversal permutation for size N
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(N)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+template <class F> struct FFTPlan {
+  static_assert(is_floating_point<F>::value,
+                "F must be a floating point type");
+  int N; vector<complex<F>> rt; vector<int> ord;
+  FFTPlan(int N = 1) : N(N), rt(max(N, 2), 1), ord(N, 0) {
+    assert(N > 0 && !(N & (N - 1))); F PI = acos(F(-1));
+    for (int k = 2; k < N; k <<= 1) {
+      complex<F> x = polar(F(1), PI / k);
+      for (int i = k; i < (k << 1); i++)
+        rt[i] = i & 1 ? rt[i >> 1] * x : rt[i >> 1];
+    }
+    int len = __builtin_ctz(N); for (int i = 1; i < N; i++)
+      ord[i] = (ord[i >> 1] >> 1) + ((i & 1) << (len - 1));
+  }
+};
+
+// Returns a thread local FFTPlan with a size of at least N, which is only
+//   rebuilt when a larger size is required
+template <class F> const FFTPlan<F> &defaultFFTPlan(int N) {
+  thread_local FFTPlan<F> plan; if (plan.N < N) plan = FFTPlan<F>(N);
+  return plan;
+}
+
 // Fast Fourier Transform
 // Template Arguments:
 //   F: the floating point type of the complex number components
 // Function Arguments:
 //   a: a reference to the vector of complex numbers (of type complex<F>)
 //     to convolute
+//   plan: the FFTPlan to use, must have a size of at least size(a); if not
+//     provided, a thread local plan is used, so the function is reentrant
 // In practice, has a moderate constant, faster than using Karatsuba, slower
 //   than NTT
 // Time Complexity: O(N log N) where N = size(a)
 // Memory Complexity: O(N)
 // Tested:
+//   Fuzz Tested
 //   https://open.kattis.com/problems/polymul2
 //   https://dmoj.ca/problem/atimesb
-template <class F> void fft(vector<complex<F>> &a) {
-  static_assert(is_floating_point<F>::value,
-                "F must be a floating point type");
-  static vector<complex<F>> rt(2, 1); static vector<int> ord; static int k = 2;
-  static F PI = acos(F(-1)); int N = a.size(); assert(!(N & (N - 1)));
-  for (; k < N; k <<= 1) {
-    rt.resize(N); complex<F> x = polar(F(1), PI / k);
-    for (int i = k; i < (k << 1); i++)
-      rt[i] = i & 1 ? rt[i >> 1] * x : rt[i >> 1];
+template <class F> void fft(vector<complex<F>> &a, const FFTPlan<F> &plan) {
+  int N = a.size(); assert(!(N & (N - 1))); assert(N <= plan.N);
+  const vector<complex<F>> &rt = plan.rt; const vector<int> &ord = plan.ord;
+  int shift = N == 0 ? 0 : __builtin_ctz(plan.N) - __builtin_ctz(N);
+  for (int i = 0; i < N; i++) {
+    int j = ord[i] >> shift; if (i < j) swap(a[i], a[j]);
   }
-  if (int(ord.size()) != N) {
-    ord.assign(N, 0); int len = __builtin_ctz(N); for (int i = 0; i < N; i++)
-      ord[i] = (ord[i >> 1] >> 1) + ((i & 1) << (len - 1));
-  }
-  for (int i = 0; i < N; i++) if (i < ord[i]) swap(a[i], a[ord[i]]);
   for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1)
     for (int j = 0; j < len; j++) {
       complex<F> u = a[i + j], x = a[len + i + j], y = rt[len + j];
@@ -39,6 +75,10 @@ template <class F> void fft(vector<complex<F>> &a) {
     }
 }
 
+template <class F> void fft(vector<complex<F>> &a) {
+  fft(a, defaultFFTPlan<F>(a.size()));
+}
+
 // Polynomial Multiplication
 // Template Arguments:
 //   T: the type of each element
@@ -48,16 +88,21 @@ template <class F> void fft(vector<complex<F>> &a) {
 //     the coefficient of x^i
 //   b: a vector of type T representing the second polynomial, b[i] stores
 //     the coefficient of x^i
+//   plan: a pointer to the FFTPlan to use, must have a size of at least
+//     size(a) + size(b) - 1 rounded up to a power of 2; if nullptr, a
+//     thread local plan is used
 // Return Value: a vector of type T representing the polynomial a times b with
 //   no trailing zeros
 // In practice, has a moderate constant
 // Time Complexity: O(N log N) where N = size(a) + size(b)
 // Memory Complexity: O(N)
 // Tested:
+//   Fuzz Tested
 //   https://open.kattis.com/problems/polymul2
 const int FFT_CUTOFF = 30000;
 template <class T, class F = long double>
-vector<T> mulPolyFFT(const vector<T> &a, const vector<T> &b) {
+vector<T> mulPolyFFT(const vector<T> &a, const vector<T> &b,
+                     const FFTPlan<F> *plan = nullptr) {
   int N = max(0, int(a.size()) + int(b.size()) - 1);
   if ((long long)(a.size()) * (long long)(b.size()) <= FFT_CUTOFF) {
     vector<T> res(N, T()); for (int i = 0; i < int(a.size()); i++)
@@ -69,12 +114,15 @@ vector<T> mulPolyFFT(const vector<T> &a, const vector<T> &b) {
   vector<complex<F>> f(N, complex<F>(0, 0));
   for (int i = 0; i < int(a.size()); i++) f[i].real(a[i]);
   for (int i = 0; i < int(b.size()); i++) f[i].imag(b[i]);
-  fft(f); complex<F> r(0, F(-0.25) / N); for (int i = 0; i <= N / 2; i++) {
+  if (!plan) plan = &defaultFFTPlan<F>(N);
+  fft(f, *plan); complex<F> r(0, F(-0.25) / N);
+  for (int i = 0; i <= N / 2; i++) {
     int j = (N - i) & (N - 1);
     complex<F> prod = (f[j] * f[j] - conj(f[i] * f[i])) * r;
     f[i] = prod; f[j] = conj(prod);
   }
-  fft(f); vector<T> res(N, T()); bool isIntegral = is_integral<T>::value;
+  fft(f, *plan); vector<T> res(N, T());
+  bool isIntegral = is_integral<T>::value;
   for (int i = 0; i < N; i++)
     res[i] = isIntegral ? round(real(f[i])) : real(f[i]);
   while (int(res.size()) > 1 && res.back() == T()) res.pop_back();
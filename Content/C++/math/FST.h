@@ -2,7 +2,85 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+const int FST_TILE_BYTES = 1 << 14, FST_PARALLEL_CUTOFF = 1 << 16;
+
+// Helper for subsetTransform that splits the range [0, N) into contiguous
+//   blocks between the given number of threads, and calls f(lo, hi) for
+//   each block
+template <class F> void forSubsetBlocks(int N, int threads, F f) {
+  if (threads <= 1 || N <= 1) { f(0, N); return; }
+  int B = (N + threads - 1) / threads; vector<thread> ts;
+  for (int lo = B; lo < N; lo += B) ts.emplace_back(f, lo, min(N, lo + B));
+  f(0, min(N, B)); for (auto &&t : ts) t.join();
+}
+
+// Helper for subsetTransform that calls g(x[j], y[j]) for each j in the
+//   range [0, len), where x and y do not overlap, in fixed chunks of 8 so
+//   that the loop can be vectorized
+template <class T, class G>
+void subsetButterfly(T *__restrict__ x, T *__restrict__ y, int len, G g) {
+  if (len % 8 != 0) { for (int j = 0; j < len; j++) g(x[j], y[j]); return; }
+  for (int j = 0; j < len; j += 8) for (int k = 0; k < 8; k++)
+    g(x[j + k], y[j + k]);
+}
+
+// Applies a transform over the subsets of the bits of the indices, where
+//   each index is an element of W contiguous values, and for each bit, for
+//   each pair of indices i and i | bit with i not containing bit, g is called
+//   on each of the W pairs of values
+// The low bits are processed together inside tiles of about FST_TILE_BYTES
+//   bytes that fit in the L1 cache, and the remaining high bits are processed
+//   in groups, where each group makes a single pass over the array by taking
+//   a narrow slice of columns from each of the rows that it combines, and the
+//   tiles and the slices are split between threads
+// Template Arguments:
+//   T: the type of each value
+//   G: the type of g
+// Function Arguments:
+//   a: a pointer to the N * W values
+//   N: the number of elements, must be a power of 2
+//   W: the number of values in each element
+//   threads: the maximum number of threads to use
+//   g(u, v): the function to call on each pair of references to values,
+//     where u belongs to the index without the bit and v to the index with
+//     the bit
+// In practice, has a small constant
+// Time Complexity: O(N W log N)
+// Memory Complexity: O(threads)
+// Tested:
+//   Fuzz Tested
+template <class T, class G>
+void subsetTransform(T *a, int N, int W, int threads, G g) {
+  assert(!(N & (N - 1))); if (N * (long long)(W) < FST_PARALLEL_CUTOFF)
+    threads = 1;
+  int n = __builtin_ctz(N), b = 0;
+  while (b < n && (long long)(W * sizeof(T)) << (b + 1) <= FST_TILE_BYTES)
+    b++;
+  forSubsetBlocks(N >> b, threads, [&] (int lo, int hi) {
+    for (int t = lo; t < hi; t++) {
+      T *p = a + ((long long)(t) << b) * W;
+      for (int len = 1; len < (1 << b); len <<= 1)
+        for (int i = 0; i < (1 << b); i += len * 2)
+          subsetButterfly(p + i * W, p + (i + len) * W, len * W, g);
+    }
+  });
+  for (int L = b, K = max(1, b / 2); L < n; L += K) {
+    int k = min(K, n - L), S = 1 << max(0, b - k), C = (1 << L) / S;
+    forSubsetBlocks((N >> (L + k)) * C, threads, [&] (int lo, int hi) {
+      for (int u = lo; u < hi; u++) {
+        T *p = a + (((long long)(u / C) << (L + k)) + (u % C) * S) * W;
+        for (int t = 0; t < k; t++) for (int r = 0; r < (1 << k); r++)
+          if (!(r >> t & 1))
+            subsetButterfly(p + ((long long)(r) << L) * W,
+                            p + ((long long)(r | 1 << t) << L) * W, S * W, g);
+      }
+    });
+  }
+}
+
 // Fast Subset Transform (similar to SumOverSubsets)
+// Uses subsetTransform to process the low bits in L1 sized tiles with
+//   vectorized butterflies and to split the work between threads
 // Template Arguments:
 //   TYPE: the type of susbet transform (OR, AND, or XOR)
 //   T: the type of each element
@@ -10,6 +88,7 @@ using namespace std;
 //   a: a reference to the vector of type T to transform
 //   inv: a boolean indicating whether the inverse transform should be
 //     performed or not
+//   threads: the maximum number of threads to use
 // In practice, has a small constant
 // Time Complexity: O(N log N) where N = size(a)
 // Memory Complexity: O(1)
@@ -19,17 +98,74 @@ using namespace std;
 //   https://judge.yosupo.jp/problem/bitwise_xor_convolution
 //   https://csacademy.com/contest/round-53/task/maxor/
 const int OR = 0, AND = 1, XOR = 2;
-template <const int TYPE, class T> void fst(vector<T> &a, bool inv) {
-  int N = a.size(); assert(!(N & (N - 1)));
-  for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1)
-    for (int j = 0; j < len; j++) {
-      T &u = a[i + j], &v = a[len + i + j];
-      if (TYPE == OR) tie(u, v) = inv ? make_pair(v, u - v)
-                                      : make_pair(u + v, u);
-      else if (TYPE == AND) tie(u, v) = inv ? make_pair(v - u, u)
-                                            : make_pair(v, u + v);
-      else if (TYPE == XOR) tie(u, v) = make_pair(u + v, u - v);
-      else assert(false);
-    }
+template <const int TYPE, class T>
+void fst(vector<T> &a, bool inv, int threads = 1) {
+  int N = a.size(); assert(!(N & (N - 1))); if (N == 0) return;
+  if (TYPE == OR) {
+    if (inv) subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      T t = u; u = v; v = t - v;
+    });
+    else subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      T t = u; u = t + v; v = t;
+    });
+  } else if (TYPE == AND) {
+    if (inv) subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      T t = u; u = v - t; v = t;
+    });
+    else subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      T t = u; u = v; v = t + v;
+    });
+  } else if (TYPE == XOR) {
+    subsetTransform(a.data(), N, 1, threads, [] (T &u, T &v) {
+      T t = u; u = t + v; v = t - v;
+    });
+  } else assert(false);
   if (TYPE == XOR && inv) for (auto &&ai : a) ai /= T(N);
 }
+
+// Computes the subset convolution of a and b, where the result c satisfies
+//   c[k] = sum of a[i] * b[j] over all i and j such that i | j == k and
+//   i & j == 0
+// The ranked zeta transforms are stored with the ranks of each index
+//   contiguous, so the pointwise products are local and subsetTransform
+//   processes the ranks of each index together
+// Template Arguments:
+//   T: the type of each element
+// Function Arguments:
+//   a: a vector of type T
+//   b: a vector of type T of the same size as a
+//   threads: the maximum number of threads to use
+// Return Value: a vector of type T with the subset convolution of a and b
+// In practice, has a small constant
+// Time Complexity: O(N (log N)^2) where N = size(a)
+// Memory Complexity: O(N log N)
+// Tested:
+//   Fuzz Tested
+template <class T>
+vector<T> subsetConvolution(const vector<T> &a, const vector<T> &b,
+                            int threads = 1) {
+  int N = a.size(); assert(!(N & (N - 1)) && int(b.size()) == N);
+  if (N == 0) return vector<T>();
+  int W = __builtin_ctz(N) + 1; vector<T> A(N * W, T()), B(N * W, T());
+  for (int i = 0; i < N; i++) {
+    A[i * W + __builtin_popcount(i)] = a[i];
+    B[i * W + __builtin_popcount(i)] = b[i];
+  }
+  auto zeta = [] (T &u, T &v) { v += u; };
+  subsetTransform(A.data(), N, W, threads, zeta);
+  subsetTransform(B.data(), N, W, threads, zeta);
+  forSubsetBlocks(N, N * W < FST_PARALLEL_CUTOFF ? 1 : threads,
+                  [&] (int lo, int hi) {
+    vector<T> h(W); for (int i = lo; i < hi; i++) {
+      T *x = A.data() + i * W, *y = B.data() + i * W;
+      for (int k = 0; k < W; k++) {
+        h[k] = T(); for (int j = 0; j <= k; j++) h[k] += x[j] * y[k - j];
+      }
+      copy(h.begin(), h.end(), x);
+    }
+  });
+  subsetTransform(A.data(), N, W, threads, [] (T &u, T &v) { v -= u; });
+  vector<T> c(N); for (int i = 0; i < N; i++)
+    c[i] = A[i * W + __builtin_popcount(i)];
+  return c;
+}
@@ -0,0 +1,186 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "ModularArithmetic.h"
+#include "ModularArithmeticAdvanced.h"
+#include "NTT.h"
+using namespace std;
+
+// Formal power series modulo an NTT friendly prime, stored as a vector of
+//   coefficients where the ith element is the coefficient of x^i
+// All Newton iterations work directly on NTTMontgomery transforms, and the
+//   transform buffers are allocated once per call and reused for each step
+// Template Arguments:
+//   T: the type of the integer, must be integral
+//   MOD: the value to mod by, must be a prime less than 2^30 in the form
+//       C * 2^K + 1 for some integers C, K where 2N <= 2^K
+// Constructor Arguments:
+//   any of the vector constructors, or a vector of type T
+// Functions:
+//   inv(n): returns the multiplicative inverse of this series modulo x^n,
+//     the constant term must be non zero
+//   log(n): returns the natural logarithm of this series modulo x^n, the
+//     constant term must be 1
+//   exp(n): returns the exponential of this series modulo x^n, the constant
+//     term must be 0
+//   sqrt(n): returns a square root of this series modulo x^n, or an empty
+//     series if none exist
+//   pow(k, n): returns this series to the power of k modulo x^n, assuming
+//     0^0 = 1
+//   divMod(b): returns the quotient and remainder of the polynomial
+//     division of this polynomial by b, where the quotient has
+//     size() - size(b) + 1 coefficients (or none if size() < size(b)), and
+//     the remainder has size(b) - 1 coefficients; b must have a non zero
+//     leading coefficient
+//   +, -: coefficient wise addition and subtraction
+//   *: polynomial multiplication with no trailing zeros
+//   /, %: the quotient and remainder of the polynomial division
+// In practice, has a moderate constant
+// Time Complexity:
+//   inv, log, exp, sqrt: O(n log n)
+//   pow: O(n log n + log k)
+//   divMod, /, %: O(N log N) where N is the size of the dividend
+//   +, -: O(N)
+//   *: O(N log N) where N is the size of the product
+// Memory Complexity: O(n) for inv, log, exp, sqrt, pow, O(N) otherwise
+// Tested:
+//   Fuzz Tested
+template <class T, const T MOD> struct FPS : public vector<T> {
+  static_assert(is_integral<T>::value, "T must be an integral type");
+  static_assert(MOD < (T(1) << 30), "MOD must be less than 2^30");
+  using vector<T>::vector; using Engine = NTTMontgomery<uint32_t(MOD)>;
+  struct Workspace { vector<uint32_t> A, B; };
+  FPS(const vector<T> &v) : vector<T>(v) {}
+  int size() const { return vector<T>::size(); }
+  static const Engine &engine() { static const Engine E; return E; }
+  static void fwd(vector<uint32_t> &buf, const vector<T> &a, int len, int N) {
+    buf.assign(N, 0); len = min(len, int(a.size()));
+    for (int i = 0; i < len; i++) buf[i] = a[i];
+    engine().forward(buf);
+  }
+  static void dot(vector<uint32_t> &a, const vector<uint32_t> &b) {
+    const Engine &E = engine();
+    for (int i = 0; i < int(a.size()); i++) a[i] = E.mul(a[i], b[i]);
+  }
+  static void bwd(vector<uint32_t> &buf) {
+    const Engine &E = engine(); E.inverse(buf); int N = buf.size();
+    uint32_t c = E.mul(E.pow(E.mul(N, E.R2), MOD - 2), E.R2);
+    for (int i = 0; i < N; i++) {
+      buf[i] = E.mul(buf[i], c); if (buf[i] >= MOD) buf[i] -= MOD;
+    }
+  }
+  static vector<T> mulTrunc(const vector<T> &a, const vector<T> &b, int n,
+                            Workspace &w) {
+    int na = min(int(a.size()), n), nb = min(int(b.size()), n), N = 1;
+    vector<T> res(n, T()); if (na == 0 || nb == 0) return res;
+    while (N < na + nb - 1) N <<= 1;
+    fwd(w.A, a, na, N); fwd(w.B, b, nb, N); dot(w.A, w.B); bwd(w.A);
+    for (int i = 0; i < n && i < N; i++) res[i] = w.A[i];
+    return res;
+  }
+  static vector<T> invImpl(const vector<T> &f, int n, Workspace &w) {
+    assert(!f.empty() && f[0] != T());
+    vector<T> g(1, mulInvModPrime(f[0], MOD)); for (int m = 1; m < n; m *= 2) {
+      fwd(w.A, f, m * 2, m * 2); fwd(w.B, g, m, m * 2); dot(w.A, w.B);
+      bwd(w.A); fill(w.A.begin(), w.A.begin() + m, 0);
+      engine().forward(w.A); dot(w.A, w.B); bwd(w.A); g.resize(m * 2);
+      for (int i = m; i < m * 2; i++) g[i] = w.A[i] == 0 ? T() : MOD - w.A[i];
+    }
+    g.resize(n); return g;
+  }
+  static vector<T> logImpl(const vector<T> &f, int n, Workspace &w) {
+    assert(!f.empty() && f[0] == T(1)); if (n <= 1) return vector<T>(n, T());
+    vector<T> d(n - 1, T()), inv(n, T(1));
+    for (int i = 1; i < n && i < int(f.size()); i++)
+      d[i - 1] = mulMod(f[i], T(i), MOD);
+    for (int i = 2; i < n; i++)
+      inv[i] = mulMod(MOD - MOD / i, inv[MOD % i], MOD);
+    vector<T> h = mulTrunc(d, invImpl(f, n - 1, w), n - 1, w), res(n, T());
+    for (int i = 1; i < n; i++) res[i] = mulMod(h[i - 1], inv[i], MOD);
+    return res;
+  }
+  static vector<T> expImpl(const vector<T> &f, int n, Workspace &w) {
+    assert(f.empty() || f[0] == T()); vector<T> g(1, T(1));
+    for (int m = 1; m < n; m *= 2) {
+      vector<T> h = logImpl(g, m * 2, w);
+      for (int i = 0; i < m * 2; i++)
+        h[i] = subMod(i < int(f.size()) ? f[i] : T(), h[i], MOD);
+      h[0] = addMod(h[0], T(1), MOD); g = mulTrunc(g, h, m * 2, w);
+    }
+    g.resize(n); return g;
+  }
+  FPS inv(int n = -1) const {
+    if (n < 0) n = size();
+    Workspace w; return invImpl(*this, n, w);
+  }
+  FPS log(int n = -1) const {
+    if (n < 0) n = size();
+    Workspace w; return logImpl(*this, n, w);
+  }
+  FPS exp(int n = -1) const {
+    if (n < 0) n = size();
+    Workspace w; return expImpl(*this, n, w);
+  }
+  FPS sqrt(int n = -1) const {
+    if (n < 0) n = size();
+    int z = 0; while (z < size() && (*this)[z] == T()) z++;
+    if (z == size() || z / 2 >= n) return FPS(n, T());
+    if (z % 2 == 1) return FPS();
+    T s0 = sqrtMod((*this)[z], MOD); if (s0 < T()) return FPS();
+    int len = n - z / 2; vector<T> f(this->begin() + z, this->end());
+    vector<T> s(1, s0); Workspace w; T inv2 = (MOD + 1) / 2;
+    for (int m = 1; m < len; m *= 2) {
+      vector<T> t = mulTrunc(f, invImpl(s, m * 2, w), m * 2, w);
+      s.resize(m * 2, T()); for (int i = 0; i < m * 2; i++)
+        s[i] = mulMod(addMod(s[i], t[i], MOD), inv2, MOD);
+    }
+    FPS res(n, T()); copy(s.begin(), s.begin() + len, res.begin() + z / 2);
+    return res;
+  }
+  template <class U> FPS pow(U k, int n = -1) const {
+    if (n < 0) n = size();
+    FPS res(n, T()); if (n == 0) return res;
+    if (k == U()) { res[0] = T(1); return res; }
+    int z = 0; while (z < size() && (*this)[z] == T()) z++;
+    if (z == size() || (z > 0 && (k >= U(n) || z * (long long)(k) >= n)))
+      return res;
+    int shift = z * (long long)(k), len = n - shift;
+    T c = (*this)[z], ic = mulInvModPrime(c, MOD), km = T(k % U(MOD));
+    vector<T> g(min(len, size() - z)); for (int i = 0; i < int(g.size()); i++)
+      g[i] = mulMod((*this)[z + i], ic, MOD);
+    Workspace w; vector<T> l = logImpl(g, len, w);
+    for (auto &&li : l) li = mulMod(li, km, MOD);
+    vector<T> e = expImpl(l, len, w); T ck = powMod(c, k, MOD);
+    for (int i = 0; i < len; i++) res[shift + i] = mulMod(e[i], ck, MOD);
+    return res;
+  }
+  pair<FPS, FPS> divMod(const FPS &b) const {
+    int n = size(), k = b.size(); assert(k > 0 && b.back() != T());
+    if (n < k) {
+      FPS r = *this; r.resize(k - 1, T()); return make_pair(FPS(), r);
+    }
+    int m = n - k + 1; vector<T> ra(this->rbegin(), this->rbegin() + m);
+    vector<T> rb(b.rbegin(), b.rend()); Workspace w;
+    vector<T> q = mulTrunc(ra, invImpl(rb, m, w), m, w);
+    reverse(q.begin(), q.end()); vector<T> bq = mulTrunc(b, q, k - 1, w);
+    FPS r(k - 1, T()); for (int i = 0; i < k - 1; i++)
+      r[i] = subMod((*this)[i], bq[i], MOD);
+    return make_pair(FPS(q), r);
+  }
+  FPS operator + (const FPS &b) const {
+    FPS res(max(size(), b.size()), T()); for (int i = 0; i < res.size(); i++)
+      res[i] = addMod(i < size() ? (*this)[i] : T(),
+                      i < b.size() ? b[i] : T(), MOD);
+    return res;
+  }
+  FPS operator - (const FPS &b) const {
+    FPS res(max(size(), b.size()), T()); for (int i = 0; i < res.size(); i++)
+      res[i] = subMod(i < size() ? (*this)[i] : T(),
+                      i < b.size() ? b[i] : T(), MOD);
+    return res;
+  }
+  FPS operator * (const FPS &b) const {
+    return mulPolyNTT<T, MOD>(*this, b, this == &b);
+  }
+  FPS operator / (const FPS &b) const { return divMod(b).first; }
+  FPS operator % (const FPS &b) const { return divMod(b).second; }
+};
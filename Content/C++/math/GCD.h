@@ -152,3 +152,156 @@ template <class T> pair<T, T> CRT(pair<T, T> a, pair<T, T> b) {
   T mul = (b.first - a.first) / g * mulInv(A % B, B) % B;
   return make_pair(((mul * a.second + a.first) % l + l) % l, l);
 }
+
+// Helper function to count the trailing zeros of a non zero value of at
+//   most 64 bits
+template <class T> int ctzBinary(T x) {
+  static_assert(sizeof(T) <= 8, "T must have at most 64 bits");
+  return sizeof(T) <= 4 ? __builtin_ctz(x) : __builtin_ctzll(x);
+}
+
+// Iterative binary greatest common divisor function using __builtin_ctz
+//   to remove all factors of 2 at once, and no division, where the minimum
+//   and the absolute difference are computed with masks instead of branches
+// Always returns a non negative integer
+// Template Arguments:
+//   T: the type of a and b, must have at most 64 bits
+// Function Arguments:
+//   a: the first value
+//   b: the second value
+// Return Value: the greatest common divisor of a and b
+// In practice, has a very small constant, and is faster than gcd
+// Time Complexity: O(log(max(a, b)))
+// Memory Complexity: O(1)
+// Tested:
+//   Stress Tested
+template <class T> T binaryGCD(T a, T b) {
+  using U = typename make_unsigned<T>::type;
+  U x = a, y = b; if (is_signed<T>::value) {
+    if (a < 0) x = -x;
+    if (b < 0) y = -y;
+  }
+  if (x == 0) return y;
+  if (y == 0) return x;
+  int s = ctzBinary(x | y), yz = ctzBinary(y); x >>= ctzBinary(x);
+  while (true) {
+    y >>= yz; U d = y - x; if (d == 0) break;
+    U c = U(0) - U(y < x); yz = ctzBinary(d); x += d & c; y = (d ^ c) - c;
+  }
+  return x << s;
+}
+
+// Helper function for binaryEEA and binaryMulInv that computes x in the
+//   range [0, m) where ax = g modulo m for g = gcd(a, m) and an odd m, where
+//   the invariant u s + v r = m holds for the two odd remainders u and v and
+//   their coefficients r and s, the larger remainder is selected with masks
+//   instead of branches, all factors of 2 are removed at once with
+//   __builtin_ctz by doubling the other coefficient, and the resulting
+//   x 2^k is divided by 2^k with Montgomery reductions at the end
+template <class U> U binaryEEAOdd(U a, U m, U &g) {
+  U u = m, v = a, r = 0, s = 1, sgn = 0; int k = ctzBinary(v); v >>= k;
+  while (u != v) {
+    U c = U(0) - U(u < v), t = (u ^ v) & c; u ^= t; v ^= t;
+    t = (r ^ s) & c; r ^= t; s ^= t; sgn ^= c;
+    u -= v; r += s; int z = ctzBinary(u); u >>= z; s <<= z; k += z;
+  }
+  g = u; uint64_t M = m, inv = M, x = sgn ? M - s : s; if (x == M) x = 0;
+  for (int i = 0; i < 5; i++) inv *= 2 - M * inv;
+  for (inv = -inv; k > 0; k -= 63) {
+    int c = min(k, 63); uint64_t t = (x * inv) & ((uint64_t(1) << c) - 1);
+    x = (__uint128_t(t) * M + x) >> c; if (x >= M) x -= M;
+  }
+  return U(x);
+}
+
+// Iterative binary Extended Euclidean Algorithm to compute x and y, where
+//   ax + by = gcd(a, b), with no division except for a single division to
+//   compute the second coefficient from the first
+// The values of x and y may be different from the ones computed by EEA
+// Template Arguments:
+//   T: the type of a and b, must be a signed type of at most 64 bits
+// Function Arguments:
+//   a: the first value, must not be the minimum value of T
+//   b: the second value, must not be the minimum value of T
+//   x: a reference to a variable to store x
+//   y: a reference to a variable to store y
+// Return Value: the greatest common divisor of a and b
+// In practice, has a small constant
+// Time Complexity: O(log(max(a, b)))
+// Memory Complexity: O(1)
+// Tested:
+//   Stress Tested
+template <class T> T binaryEEA(T a, T b, T &x, T &y) {
+  static_assert(is_signed<T>::value, "T must be a signed type");
+  if (a == 0 || b == 0) {
+    x = a == 0 ? 0 : (a < 0 ? -1 : 1); y = a == 0 ? (b < 0 ? -1 : 1) : 0;
+    if (a == 0 && b == 0) y = 0;
+    return a < 0 || b < 0 ? -(a + b) : a + b;
+  }
+  using U = typename make_unsigned<T>::type;
+  U p = a < 0 ? -U(a) : U(a), q = b < 0 ? -U(b) : U(b), g;
+  int sh = ctzBinary(p | q); p >>= sh; q >>= sh; if (q & 1) {
+    U t = binaryEEAOdd(p, q, g); x = T(t);
+    y = T((__int128_t(g) - __int128_t(p) * t) / __int128_t(q));
+  } else {
+    U t = binaryEEAOdd(q, p, g); y = T(t);
+    x = T((__int128_t(g) - __int128_t(q) * t) / __int128_t(p));
+  }
+  if (a < 0) x = -x;
+  if (b < 0) y = -y;
+  return T(g << sh);
+}
+
+// Computes the multiplicative inverse of a in Zm with the binary
+//   algorithm of binaryEEAOdd, and falls back to mulInv if m is even
+// Inverse only exists if gcd(a, m) == 1
+// Template Arguments:
+//   T: the type of a and m, must have at most 64 bits
+// Function Arguments:
+//   a: the value to find the inverse of, must be in the range [0, m)
+//   m: the mod, must be positive
+// Return Value: the multiplicative inverse of a in Zm, -1 if no inverse
+// In practice, has a small constant, and is faster than mulInv
+// Time Complexity: O(log m)
+// Memory Complexity: O(1)
+// Tested:
+//   Stress Tested
+template <class T> T binaryMulInv(T a, T m) {
+  if (a == 0) return -1;
+  if (!(m & 1)) return mulInv(a, m);
+  using U = typename make_unsigned<T>::type;
+  U g, x = binaryEEAOdd(U(a), U(m), g); return g == 1 ? T(x) : T(-1);
+}
+
+// Computes the multiplicative inverses of all elements of A in Zm with
+//   Montgomery's trick, where the prefix products are inverted with a
+//   single call to mulInv, using 3(N - 1) multiplications in total
+// If any of the non zero elements does not have an inverse, each element is
+//   inverted separately instead
+// Template Arguments:
+//   T: the type of the elements and m, where (m - 1) * (m - 1) must fit in T
+// Function Arguments:
+//   A: a vector of the values to find the inverses of, each must be in the
+//     range [0, m)
+//   m: the mod, must be positive
+// Return Value: a vector of type T with the multiplicative inverse of each
+//   element in Zm, -1 if no inverse
+// In practice, has a very small constant
+// Time Complexity: O(N + log m)
+// Memory Complexity: O(N)
+// Tested:
+//   Stress Tested
+template <class T> vector<T> mulInvBatch(const vector<T> &A, T m) {
+  int N = A.size(); vector<T> ret(N, T(-1)); T prod = 1 % m;
+  for (int i = 0; i < N; i++) {
+    ret[i] = prod; if (A[i] != 0) prod = prod * A[i] % m;
+  }
+  T inv = mulInv(prod, m); if (inv == -1) {
+    for (int i = 0; i < N; i++) ret[i] = mulInv(A[i], m);
+    return ret;
+  }
+  for (int i = N - 1; i >= 0; i--) if (A[i] != 0) {
+    ret[i] = ret[i] * inv % m; inv = inv * A[i] % m;
+  } else ret[i] = -1;
+  return ret;
+}
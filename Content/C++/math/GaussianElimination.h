@@ -57,3 +57,125 @@ template <class T> struct GaussianElimination {
     for (int i = 0; i < N; i++) if (ind[i] == -1) solutions = INF_SOLUTIONS;
   }
 };
+
+// Solve the equation Ax = b modulo a prime for a matrix A of size M x N, and
+//   vectors b of size M, and vector x of size N, and also computes the rank
+//   and a basis of the nullspace
+// The augmented matrix is stored in a single flat array, and the row echelon
+//   form is computed in blocks of up to K pivot rows, where the K pivot rows
+//   are found and reduced against each other by only computing the needed
+//   entries of the rows below, and each row below is then updated once with
+//   all K pivot rows, where the K products for each entry are accumulated in
+//   64 bits before a single modular reduction, after which each vector is
+//   found by back substitution
+// Template Arguments:
+//   T: the type of each element
+// Constructor Arguments:
+//   A: a M x N matrix, with each element in the range [0, MOD)
+//   b: a vector, with dimension M, with each element in the range [0, MOD)
+//   MOD: a prime modulus less than 2^32
+// Fields:
+//   NO_SOLUTION: static const int representing no solution
+//   ONE_SOLUTION: static const int representing one solution
+//   INF_SOLUTIONS: static const int representing infinite solution
+//   M: the number of equations
+//   N: the number of variables
+//   K: the number of pivot rows in each block, which is the largest value
+//     up to 16 so that K products can be accumulated in 64 bits
+//   rank: the rank of the matrix A
+//   solutions: the number of solution to the equation, equal to one of
+//     NO_SOLUTION, ONE_SOLUTION, or INF_SOLUTIONS
+//   MOD: the modulus
+//   x: the solution vector with dimension N, can be any solution if there are
+//     infinite solutions, empty if no solutions
+//   nullspace: a basis of the vectors y with Ay = 0 modulo MOD
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(min(M, N) MN + (N - rank + 1) rank N)
+// Memory Complexity: O(MN + N (N - rank))
+// Tested:
+//   Fuzz Tested
+template <class T> struct GaussianEliminationMod {
+  static const int NO_SOLUTION = 0, ONE_SOLUTION = 1, INF_SOLUTIONS = 2;
+  int M, N, K, rank, solutions; T MOD; vector<T> x;
+  vector<vector<T>> nullspace;
+  GaussianEliminationMod(const vector<vector<T>> &A, const vector<T> &b,
+                         T MOD)
+      : M(A.size()), N(M == 0 ? 0 : A[0].size()), K(16), rank(0),
+        solutions(ONE_SOLUTION), MOD(MOD) {
+    int S = N + 1; uint64_t P = MOD, P1 = P - 1;
+    if (P1 > 1) K = min(uint64_t(K), (UINT64_MAX - P) / (P1 * P1));
+    vector<uint32_t> a(size_t(M) * S), F(size_t(K) * S);
+    for (int i = 0; i < M; i++) {
+      copy(A[i].begin(), A[i].end(), a.begin() + size_t(i) * S);
+      a[size_t(i) * S + N] = b[i];
+    }
+    auto row = [&] (int i) { return a.data() + size_t(i) * S; };
+    auto inv = [&] (uint64_t v) {
+      uint64_t ret = 1; for (uint64_t e = P - 2; e > 0; e >>= 1) {
+        if (e & 1) ret = ret * v % P;
+        v = v * v % P;
+      }
+      return ret;
+    };
+    vector<uint64_t> acc(S); vector<int> piv, cols;
+    for (int c = 0, r = 0; c < N && r < M; r += cols.size()) {
+      int c0 = c; cols.clear();
+      for (; c < N && int(cols.size()) < K && r + int(cols.size()) < M;
+           c++) {
+        int q = r + cols.size(), p = q, cnt = cols.size(); uint64_t v = 0;
+        for (; p < M; p++) {
+          const uint32_t *z = row(p); v = z[c]; for (int t = 0; t < cnt; t++)
+            v += (P - z[cols[t]]) * F[size_t(t) * S + c];
+          if ((v %= P) != 0) break;
+        }
+        if (p == M) continue;
+        swap_ranges(row(p), row(p) + S, row(q)); const uint32_t *z = row(q);
+        copy(z + c, z + S, acc.begin() + c); for (int t = 0; t < cnt; t++)
+          if (uint64_t h = (P - z[cols[t]]) % P) {
+            const uint32_t *g = F.data() + size_t(t) * S;
+            for (int j = c; j < S; j++) acc[j] += h * g[j];
+          }
+        uint64_t iv = inv(v); uint32_t *f = F.data() + size_t(cnt) * S;
+        fill(f + c0, f + c, 0);
+        for (int j = c; j < S; j++) f[j] = acc[j] % P * iv % P;
+        for (int t = 0; t < cnt; t++) {
+          uint32_t *g = F.data() + size_t(t) * S; uint64_t h = (P - g[c]) % P;
+          if (h != 0) for (int j = c; j < S; j++) g[j] = (g[j] + h * f[j]) % P;
+        }
+        cols.push_back(c);
+      }
+      int cnt = cols.size(); for (int i = r + cnt; i < M; i++) {
+        uint32_t *z = row(i); copy(z + c0, z + S, acc.begin() + c0);
+        for (int t = 0; t < cnt; t++) if (uint64_t h = (P - z[cols[t]]) % P) {
+          const uint32_t *g = F.data() + size_t(t) * S;
+          for (int j = c0; j < S; j++) acc[j] += h * g[j];
+        }
+        for (int j = c0; j < S; j++) z[j] = acc[j] % P;
+      }
+      for (int t = 0; t < cnt; t++)
+        copy(F.begin() + size_t(t) * S + c0, F.begin() + size_t(t + 1) * S,
+             row(r + t) + c0);
+      piv.insert(piv.end(), cols.begin(), cols.end());
+    }
+    rank = piv.size(); vector<bool> isPiv(N, false);
+    for (int t = 0; t < rank; t++) isPiv[piv[t]] = true;
+    auto back = [&] (vector<T> &y, bool useB) {
+      for (int t = rank - 1; t >= 0; t--) {
+        const uint32_t *z = row(t); uint64_t s = useB ? P - z[N] : 0;
+        for (int j = piv[t] + 1; j < N; j += K) {
+          for (int k = j; k < min(N, j + K); k++) s += uint64_t(z[k]) * y[k];
+          s %= P;
+        }
+        y[piv[t]] = T((P - s) % P);
+      }
+    };
+    for (int f = 0; f < N; f++) if (!isPiv[f]) {
+      vector<T> y(N, T()); y[f] = T(1 % P); back(y, false);
+      nullspace.push_back(move(y));
+    }
+    for (int i = rank; i < M; i++)
+      if (row(i)[N] != 0) { solutions = NO_SOLUTION; return; }
+    x.assign(N, T()); back(x, true); if (rank < N) solutions = INF_SOLUTIONS;
+  }
+};
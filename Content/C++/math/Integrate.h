@@ -29,3 +29,149 @@ template <class F, class T> T rec(F &f, T a, T b, T eps, T s) {
 //   https://codeforces.com/problemsets/acmsguru/problem/99999/217
 template <class F, class T>
 T integrate(F f, T a, T b, T eps) { return rec(f, a, b, eps, S(f, a, b)); }
+
+// Helper for integrateGaussKronrod and integrateBatch that splits the range
+//   [0, N) into contiguous blocks between the given number of threads, and
+//   calls f(lo, hi) for each block
+template <class F> void forIntervalBlocks(int N, int threads, F f) {
+  if (threads <= 1 || N <= 1) { f(0, N); return; }
+  int B = (N + threads - 1) / threads; vector<thread> ts;
+  for (int lo = B; lo < N; lo += B) ts.emplace_back(f, lo, min(N, lo + B));
+  f(0, min(N, B)); for (auto &&t : ts) t.join();
+}
+
+// Helper for integrateGaussKronrod that returns the 15 point Gauss-Kronrod
+//   estimate of the integral of f over the range [a, b], and sets err to its
+//   difference with the embedded 7 point Gauss estimate
+template <class F, class T> T gaussKronrod15(F &f, T a, T b, T &err) {
+  static const long double XK[8] = {
+    0.991455371120812639206854697526329L,
+    0.949107912342758524526189684047851L,
+    0.864864423359769072789712788640926L,
+    0.741531185599394439863864773280788L,
+    0.586087235467691130294144845693013L,
+    0.405845151377397166906606412076961L,
+    0.207784955007898467600689403773245L, 0.0L
+  }, WK[8] = {
+    0.022935322010529224963732008058970L,
+    0.063092092629978553290700663189204L,
+    0.104790010322250183839876322541518L,
+    0.140653259715525918745189590510238L,
+    0.169004726639267902826583426598550L,
+    0.190350578064785409913256402421014L,
+    0.204432940075298892414161999234649L,
+    0.209482141084727828012999174891714L
+  }, WG[4] = {
+    0.129484966168869693270611432679082L,
+    0.279705391489276667901467771423780L,
+    0.381830050505118944950369775488975L,
+    0.417959183673469387755102040816327L
+  };
+  T c = (a + b) / 2, h = (b - a) / 2, fc = f(c), k = fc * T(WK[7]);
+  T g = fc * T(WG[3]); for (int i = 0; i < 7; i++) {
+    T d = h * T(XK[i]), s = f(c - d) + f(c + d); k += s * T(WK[i]);
+    if (i % 2 == 1) g += s * T(WG[i / 2]);
+  }
+  err = abs((k - g) * h); return k * h;
+}
+
+// Integrates the function f over the range [a, b] with globally adaptive
+//   Gauss-Kronrod 7/15 quadrature
+// A priority queue of the subintervals ordered by their error estimates is
+//   kept, and in each round the subintervals with the largest errors are
+//   bisected, stopping once their errors cover the excess over eps, with the
+//   new halves evaluated in parallel, until the sum of the error estimates is
+//   at most eps, or the number of subintervals reaches maxIntervals, or no
+//   subinterval can be bisected further
+// Template Arguments:
+//   F: the type of f
+//   T: the type of the bounds and the return value of the function f
+// Function Arguments:
+//   f(x): the function returning the y value at x, which must be safe to
+//     call concurrently if threads is greater than 1
+//   a: the lower bound
+//   b: the upper bound
+//   eps: the maximum absolute error
+//   threads: the maximum number of threads to use, where each round bisects
+//     up to 4 * threads subintervals if threads is greater than 1, and a
+//     single subinterval otherwise
+//   maxIntervals: the maximum number of subintervals
+// Return Value: the integral of f over the range [a, b]
+// In practice, has a small constant, and uses far fewer evaluations of f
+//   than integrate for smooth functions
+// Time Complexity: O(I log I + 15 I (cost to compute f(x)) / threads) where
+//   I is the final number of subintervals
+// Memory Complexity: O(I + threads)
+// Tested:
+//   Fuzz Tested
+template <class F, class T>
+T integrateGaussKronrod(F f, T a, T b, T eps, int threads = 1,
+                        int maxIntervals = 1 << 20) {
+  struct Interval {
+    T a, b, val, err;
+    bool operator < (const Interval &o) const { return err < o.err; }
+  };
+  vector<Interval> cur(1, Interval{a, b, T(), T()}), fin;
+  cur[0].val = gaussKronrod15(f, a, b, cur[0].err);
+  priority_queue<Interval> PQ(cur.begin(), cur.end());
+  T err = cur[0].err; int B = threads <= 1 ? 1 : threads * 4;
+  while (!PQ.empty() && int(PQ.size() + fin.size()) < maxIntervals) {
+    if (!(err > eps)) {
+      err = T(); for (auto &&I : fin) err += I.err;
+      vector<Interval> all; for (; !PQ.empty(); PQ.pop()) {
+        all.push_back(PQ.top()); err += PQ.top().err;
+      }
+      PQ = priority_queue<Interval>(all.begin(), all.end());
+      if (!(err > eps)) break;
+    }
+    cur.clear(); T need = err - eps;
+    while (int(cur.size()) < B * 2 && !PQ.empty() && need > T()
+        && int(PQ.size() + fin.size() + cur.size()) < maxIntervals) {
+      Interval I = PQ.top(); PQ.pop(); T m = (I.a + I.b) / 2;
+      if (m == I.a || m == I.b) { fin.push_back(I); continue; }
+      err -= I.err; need -= I.err; cur.push_back(Interval{I.a, m, T(), T()});
+      cur.push_back(Interval{m, I.b, T(), T()});
+    }
+    forIntervalBlocks(cur.size(), threads, [&] (int lo, int hi) {
+      for (int i = lo; i < hi; i++)
+        cur[i].val = gaussKronrod15(f, cur[i].a, cur[i].b, cur[i].err);
+    });
+    for (auto &&I : cur) { err += I.err; PQ.push(I); }
+  }
+  T ret = T(); for (auto &&I : fin) ret += I.val;
+  for (; !PQ.empty(); PQ.pop()) ret += PQ.top().val;
+  return ret;
+}
+
+// Integrates each function f[i] over the range [bounds[i].first,
+//   bounds[i].second] with integrateGaussKronrod, where the functions are
+//   distributed between threads as they finish
+// Template Arguments:
+//   F: the type of each function
+//   T: the type of the bounds and the return value of the functions
+// Function Arguments:
+//   f: a vector of the functions, where f[i](x) returns the y value at x,
+//     and different functions may be called concurrently
+//   bounds: a vector of the lower and upper bounds of each integral
+//   eps: the maximum absolute error of each integral
+//   threads: the maximum number of threads to use
+//   maxIntervals: the maximum number of subintervals of each integral
+// Return Value: a vector of the integrals
+// In practice, has a small constant
+// Time Complexity: O(sum of the time of integrateGaussKronrod for each
+//   function / threads)
+// Memory Complexity: O(max I + threads) for each thread where I is the
+//   final number of subintervals of an integral
+// Tested:
+//   Fuzz Tested
+template <class F, class T>
+vector<T> integrateBatch(const vector<F> &f, const vector<pair<T, T>> &bounds,
+                         T eps, int threads = 1, int maxIntervals = 1 << 20) {
+  int N = f.size(); vector<T> ret(N, T()); atomic<int> nxt(0);
+  forIntervalBlocks(min(N, max(threads, 1)), threads, [&] (int, int) {
+    for (int i; (i = nxt++) < N;)
+      ret[i] = integrateGaussKronrod(f[i], bounds[i].first, bounds[i].second,
+                                     eps, 1, maxIntervals);
+  });
+  return ret;
+}
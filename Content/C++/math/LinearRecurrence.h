@@ -1,5 +1,6 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "NTT.h"
 using namespace std;
 
 // Computes the Kth term of a linear recurrence of length N
@@ -35,3 +36,83 @@ T linearRecurrence(const vector<T> &A, const vector<T> &C, U K) {
   T res = T(); for (int i = 0; i < N; i++) res += P[i + 1] * A[i];
   return res;
 }
+
+// Computes the Kth term of a linear recurrence of length N modulo an NTT
+//   friendly prime using the Bostan-Mori algorithm
+//   A[i] = sum (C[j] * A[i - 1 - j]) for 0 <= j < N
+// With Q(x) = 1 - sum (C[j] * x^(j + 1)) and P(x) = A(x) * Q(x) mod x^N, the
+//   Kth term is [x^K] P(x) / Q(x), and each step replaces P(x) / Q(x) with
+//   the even or odd part of P(x) Q(-x) / Q(x) Q(-x) and halves K
+// The denominators Q_t(x) of each step do not depend on K, so their
+//   transforms are computed once and cached, and each query only requires
+//   2 transforms per step; the transform of Q_t(-x) is the transform of
+//   Q_t(x) with adjacent elements swapped, as NTTMontgomery returns the
+//   transform in bit reversed order
+// Template Arguments:
+//   T: the type of the elements in the sequence, must be integral
+//   MOD: the value to mod by, must be a prime less than 2^30 in the form
+//       C * 2^K + 1 for some integers C, K where 4N <= 2^K
+// Constructor Arguments:
+//   A: a vector of the first N terms of the sequence, in the range [0, MOD)
+//   C: a vector of the the N recurrence coefficients of the sequence, in the
+//     range [0, MOD)
+// Functions:
+//   get(K): returns the Kth term (0-indexed) of the linear recurrence
+//   getAll(K): returns a vector of the Kth terms of the linear recurrence
+//     for each K in the vector K, sharing the cached transforms
+// In practice, has a moderate constant, and is much faster than
+//   linearRecurrence for large N
+// Time Complexity:
+//   constructor: O(N log N)
+//   get: O(N log N log K)
+//   getAll: O(Q N log N log max(K)) for Q values of K
+// Memory Complexity: O(N log max(K))
+// Tested:
+//   Fuzz Tested
+template <class T, const T MOD> struct LinearRecurrenceNTT {
+  static_assert(is_integral<T>::value, "T must be an integral type");
+  static_assert(MOD < (T(1) << 30), "MOD must be less than 2^30");
+  using Engine = NTTMontgomery<uint32_t(MOD)>;
+  int N, L; uint32_t f; vector<T> A; vector<uint32_t> P;
+  vector<vector<uint32_t>> FQ; const Engine &E;
+  static const Engine &engine() { static const Engine E; return E; }
+  void normalize(vector<uint32_t> &a) const {
+    for (int i = 0; i < L; i++) {
+      a[i] = E.mul(a[i], f); if (a[i] >= MOD) a[i] -= MOD;
+    }
+  }
+  LinearRecurrenceNTT(const vector<T> &A, const vector<T> &C)
+      : N(A.size()), L(1), A(A), E(engine()) {
+    assert(A.size() == C.size()); while (L < N * 2 + 1) L <<= 1;
+    f = E.mul(E.pow(E.mul(L, E.R2), MOD - 2), E.R2);
+    vector<T> Q(N + 1, T()); Q[0] = T(1);
+    for (int j = 0; j < N; j++) Q[j + 1] = C[j] == T() ? T() : MOD - C[j];
+    vector<T> AQ = mulPolyNTT<T, MOD>(A, Q); P.assign(L, 0);
+    for (int i = 0; i < N && i < int(AQ.size()); i++) P[i] = AQ[i];
+    FQ.emplace_back(Q.begin(), Q.end()); FQ.back().resize(L, 0);
+    E.forward(FQ.back());
+  }
+  void extend() {
+    const vector<uint32_t> &F = FQ.back(); vector<uint32_t> G(L);
+    for (int j = 0; j < L; j++) G[j] = E.mul(F[j], F[j ^ 1]);
+    E.inverse(G); normalize(G); for (int i = 0; i <= N; i++) G[i] = G[i * 2];
+    fill(G.begin() + N + 1, G.end(), 0); E.forward(G); FQ.push_back(move(G));
+  }
+  template <class U> T get(U K) {
+    if (K < U(N)) return A[K];
+    vector<uint32_t> buf = P; for (int t = 0; K > U(); t++, K /= 2) {
+      if (t >= int(FQ.size())) extend();
+      E.forward(buf); const vector<uint32_t> &F = FQ[t];
+      for (int j = 0; j < L; j++) buf[j] = E.mul(buf[j], F[j ^ 1]);
+      E.inverse(buf); normalize(buf); int b = K % 2;
+      for (int i = 0; i < N; i++) buf[i] = buf[i * 2 + b];
+      fill(buf.begin() + N, buf.end(), 0);
+    }
+    return T(buf[0]);
+  }
+  template <class U> vector<T> getAll(const vector<U> &K) {
+    vector<T> ret; ret.reserve(K.size());
+    for (auto &&k : K) ret.push_back(get(k));
+    return ret;
+  }
+};
@@ -2,7 +2,42 @@
 #include <bits/stdc++.h>
 using namespace std;
 
-template <class T> using Matrix = vector<vector<T>>;
+// Matrix stored contiguously in row major order
+// Template Arguments:
+//   T: the type of each element in the matrix
+// Constructor Arguments:
+//   N: the size of the first dimension
+//   M: the size of the second dimension
+// Fields:
+//   N: the size of the first dimension
+//   M: the size of the second dimension
+//   a: a vector of size N * M where the element in row i and column j is
+//     stored at index i * M + j
+// Functions:
+//   [i]: returns a pointer to the start of row i, so elements can be
+//     accessed with A[i][j]
+//   swapRows(i, j): swaps rows i and j
+//   ==, !=: comparison operators
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor, swapRows, ==, !=: O(NM)
+//   []: O(1)
+// Memory Complexity: O(NM)
+// Tested:
+//   Fuzz Tested
+template <class T> struct Matrix {
+  int N, M; vector<T> a;
+  Matrix(int N = 0, int M = 0) : N(N), M(M), a(size_t(N) * M, T()) {}
+  T *operator [] (int i) { return a.data() + size_t(i) * M; }
+  const T *operator [] (int i) const { return a.data() + size_t(i) * M; }
+  void swapRows(int i, int j) {
+    if (i != j) swap_ranges((*this)[i], (*this)[i] + M, (*this)[j]);
+  }
+  bool operator == (const Matrix &B) const {
+    return N == B.N && M == B.M && a == B.a;
+  }
+  bool operator != (const Matrix &B) const { return !(*this == B); }
+};
 
 // Returns the size of the first dimension of a matrix
 // Template Arguments:
@@ -15,7 +50,7 @@ template <class T> using Matrix = vector<vector<T>>;
 // Memory Complexity: O(1)
 // Tested:
 //   Fuzz Tested
-template <class T> int getN(const Matrix<T> &A) { return A.size(); }
+template <class T> int getN(const Matrix<T> &A) { return A.N; }
 
 // Returns the size of the second dimension of a matrix
 // Template Arguments:
@@ -28,8 +63,7 @@ template <class T> int getN(const Matrix<T> &A) { return A.size(); }
 // Memory Complexity: O(1)
 // Tested:
 //   Fuzz Tested
-template <class T>
-int getM(const Matrix<T> &A) { return A.empty() ? 0 : A[0].size(); }
+template <class T> int getM(const Matrix<T> &A) { return A.M; }
 
 // Creates a matrix of size N x M filled with the default value of T
 // Template Arguments:
@@ -44,7 +78,7 @@ int getM(const Matrix<T> &A) { return A.empty() ? 0 : A[0].size(); }
 // Tested:
 //   Fuzz Tested
 template <class T> Matrix<T> makeMatrix(int N, int M) {
-  return vector<vector<T>>(N, vector<T>(M, T()));
+  return Matrix<T>(N, M);
 }
 
 // Creates an identity matrix of size N x N
@@ -96,8 +130,7 @@ template <class T> Matrix<T> transpose(const Matrix<T> &A) {
 //   Fuzz Tested
 template <class T> Matrix<T> &operator += (Matrix<T> &A, const Matrix<T> &B) {
   assert(getN(A) == getN(B) && getM(A) == getM(B));
-  for (int i = 0; i < getN(A); i++) for (int j = 0; j < getM(A); j++)
-    A[i][j] += B[i][j];
+  for (size_t i = 0; i < A.a.size(); i++) A.a[i] += B.a[i];
   return A;
 }
 
@@ -129,8 +162,7 @@ Matrix<T> operator + (Matrix<T> A, const Matrix<T> &B) { return A += B; }
 //   Fuzz Tested
 template <class T> Matrix<T> &operator -= (Matrix<T> &A, const Matrix<T> &B) {
   assert(getN(A) == getN(B) && getM(A) == getM(B));
-  for (int i = 0; i < getN(A); i++) for (int j = 0; j < getM(A); j++)
-    A[i][j] -= B[i][j];
+  for (size_t i = 0; i < A.a.size(); i++) A.a[i] -= B.a[i];
   return A;
 }
 
@@ -149,26 +181,126 @@ template <class T> Matrix<T> &operator -= (Matrix<T> &A, const Matrix<T> &B) {
 template <class T>
 Matrix<T> operator - (Matrix<T> A, const Matrix<T> &B) { return A -= B; }
 
+// Calls f(lo, hi) for disjoint ranges of rows covering [0, N), splitting
+//   them between the given number of threads if N is at least
+//   PARALLEL_CUTOFF, with each range except the last having a size that is
+//   a multiple of 4
+// Template Arguments:
+//   F: the type of the function
+// Function Arguments:
+//   N: the number of rows
+//   threads: the maximum number of threads to use
+//   f: the function to call
+// In practice, has a small constant
+// Time Complexity: O(threads) excluding the calls to f
+// Memory Complexity: O(threads)
+// Tested:
+//   Fuzz Tested
+const int PARALLEL_CUTOFF = 512;
+template <class F> void forRowBlocks(int N, int threads, F f) {
+  if (threads <= 1 || N < PARALLEL_CUTOFF) { f(0, N); return; }
+  int B = ((N + threads - 1) / threads + 3) / 4 * 4; vector<thread> ts;
+  for (int lo = 0; lo < N; lo += B) ts.emplace_back(f, lo, min(N, lo + B));
+  for (auto &&t : ts) t.join();
+}
+
+// Helper for mulMat and mulMatMod that computes rows [lo, hi) of the
+//   product of A and B, where B is stored in row major order with Mp
+//   columns, Mp being a multiple of 8, and the extra columns being zero
+// The product is computed in tiles of KB rows and JB columns of B, with 4
+//   rows of A handled at a time so that each element of B is loaded once
+//   per 4 rows of the result, and with the partial sums kept in a local
+//   accumulator of type U, which is passed to fold every R rows of B and to
+//   store at the end of each tile
+template <class U, class V, class T, class F, class G>
+void mulMatRows(const Matrix<T> &A, const vector<V> &B, int Mp,
+                Matrix<T> &C, int lo, int hi, int R, F fold, G store) {
+  const int KB = 256, JB = 256; int K = getM(A), M = getM(C); U acc[JB * 4];
+  for (int jj = 0; jj < M; jj += JB) for (int kk = 0; kk < K; kk += KB) {
+    int w = min(JB, M - jj), w8 = (w + 7) / 8 * 8, ke = min(K, kk + KB);
+    for (int i = lo; i < hi; i += 4) {
+      int h = min(4, hi - i), cnt = 0;
+      for (int r = 0; r < h; r++) for (int j = 0; j < w8; j++)
+        acc[r * JB + j] = j < w ? U(C[i + r][jj + j]) : U();
+      for (int k = kk; k < ke; k++) {
+        const V *b = B.data() + size_t(k) * Mp + jj; if (h == 4) {
+          U x0 = V(A[i][k]), x1 = V(A[i + 1][k]), x2 = V(A[i + 2][k]);
+          U x3 = V(A[i + 3][k]); U *c0 = acc, *c1 = acc + JB;
+          U *c2 = acc + JB * 2, *c3 = acc + JB * 3;
+          for (int j = 0; j < w8; j += 8) for (int t = j; t < j + 8; t++) {
+            U bt = b[t]; c0[t] += x0 * bt; c1[t] += x1 * bt;
+            c2[t] += x2 * bt; c3[t] += x3 * bt;
+          }
+        } else for (int r = 0; r < h; r++) {
+          U x = V(A[i + r][k]), *c = acc + r * JB;
+          for (int j = 0; j < w8; j += 8) for (int t = j; t < j + 8; t++)
+            c[t] += x * b[t];
+        }
+        if (++cnt == R) {
+          cnt = 0; for (int r = 0; r < h; r++) for (int j = 0; j < w8; j++)
+            acc[r * JB + j] = fold(acc[r * JB + j]);
+        }
+      }
+      for (int r = 0; r < h; r++) for (int j = 0; j < w; j++)
+        C[i + r][jj + j] = store(acc[r * JB + j]);
+    }
+  }
+}
+
+// Helper for mulMat and mulMatMod that copies B into a row major vector of
+//   type V with the number of columns rounded up to a multiple of 8
+template <class V, class T>
+vector<V> padColumns(const Matrix<T> &B, int Mp) {
+  vector<V> ret(size_t(getN(B)) * Mp, V());
+  for (int i = 0; i < getN(B); i++) for (int j = 0; j < getM(B); j++)
+    ret[size_t(i) * Mp + j] = V(B[i][j]);
+  return ret;
+}
+
+// Multiplies the matrices A and B, getM(A) must equal getN(B), with cache
+//   tiling and register blocking (see mulMatRows), and without reductions
+//   of any kind
+// Template Arguments:
+//   T: the type of each element in the matrix
+// Function Arguments:
+//   A: a constant reference to the first matrix
+//   B: a constant reference to the second matrix
+//   threads: the maximum number of threads to use, only used if getN(A) is
+//     at least PARALLEL_CUTOFF
+// Return Value: the matrix A times B
+// In practice, has a very small constant, and the inner loop is vectorized
+//   for arithmetic types
+// Time Complexity: O(N(A) M(B) M(A) / threads)
+// Memory Complexity: O(N(A) M(B) + N(B) M(B))
+// Tested:
+//   Fuzz Tested
+template <class T>
+Matrix<T> mulMat(const Matrix<T> &A, const Matrix<T> &B, int threads = 1) {
+  assert(getM(A) == getN(B)); int Mp = (getM(B) + 7) / 8 * 8;
+  Matrix<T> C = makeMatrix<T>(getN(A), getM(B));
+  vector<T> Bp = padColumns<T>(B, Mp);
+  auto id = [&] (const T &v) { return v; };
+  forRowBlocks(getN(A), threads, [&] (int lo, int hi) {
+    mulMatRows<T>(A, Bp, Mp, C, lo, hi, -1, id, id);
+  });
+  return C;
+}
+
 // Multiplies the matrices A and B, getM(A) must equal getN(B)
 // Template Arguments:
 //   T: the type of each element in the matrix
 // Function Arguments:
 //   A: a constant reference to the first matrix
-//   B: the matrix to multiply
+//   B: a constant reference to the second matrix
 // Return Value: the matrix A times B
 // In practice, has a very small constant
 // Time Complexity: O(N(A) M(B) M(A))
-// Memory Complexity: O((N(A) + N(B)) M(B))
+// Memory Complexity: O(N(A) M(B))
 // Tested:
 //   https://www.spoj.com/problems/MPOW/
-template <class T> Matrix<T> operator * (const Matrix<T> &A, Matrix<T> B) {
-  assert(getM(A) == getN(B));
-  B = transpose(B); Matrix<T> C = makeMatrix<T>(getN(A), getN(B));
-  for (int i = 0; i < getN(C); i++) for (int j = 0; j < getM(C); j++) {
-    T tmp = T(); for (int k = 0; k < getM(A); k++) tmp += A[i][k] * B[j][k];
-    C[i][j] = tmp;
-  }
-  return C;
+template <class T>
+Matrix<T> operator * (const Matrix<T> &A, const Matrix<T> &B) {
+  return mulMat(A, B);
 }
 
 // Multiplies the matrix B into the matrix A, getM(A) must equal getN(B)
@@ -180,7 +312,7 @@ template <class T> Matrix<T> operator * (const Matrix<T> &A, Matrix<T> B) {
 // Return Value: a reference to the matrix A after it is multipled by B
 // In practice, has a very small constant
 // Time Complexity: O(N(A) M(B) M(A))
-// Memory Complexity: O((N(A) + N(B)) M(B))
+// Memory Complexity: O(N(A) M(B))
 // Tested:
 //   https://www.spoj.com/problems/MPOW/
 template <class T>
@@ -192,6 +324,7 @@ Matrix<T> &operator *= (Matrix<T> &A, const Matrix<T> &B) { return A = A * B; }
 //   U: the type of pow
 // Function Arguments:
 //   A: the base square matrix
+//   pow: the power
 // Return Value: the matrix A raised to the power pow
 // In practice, has a very small constant
 // Time Complexity: O(N^3 log pow)
@@ -208,6 +341,84 @@ template <class T, class U> Matrix<T> powMat(Matrix<T> A, U pow) {
   return x;
 }
 
+// Multiplies the matrices A and B modulo mod, getM(A) must equal getN(B),
+//   deferring the reductions by accumulating products in unsigned 64-bit
+//   integers if mod < 2^31 (and 128-bit integers otherwise) and only
+//   reducing once per tile, or when the accumulators are about to overflow
+// Template Arguments:
+//   T: the type of each element in the matrix, must be integral
+// Function Arguments:
+//   A: a constant reference to the first matrix with elements in the range
+//     [0, mod)
+//   B: a constant reference to the second matrix with elements in the range
+//     [0, mod)
+//   mod: the modulus, must be positive and less than 2^63
+//   threads: the maximum number of threads to use, only used if getN(A) is
+//     at least PARALLEL_CUTOFF
+// Return Value: the matrix A times B modulo mod
+// In practice, has a very small constant, and the inner loop is vectorized
+//   if mod < 2^31
+// Time Complexity: O(N(A) M(B) M(A) / threads)
+// Memory Complexity: O(N(A) M(B) + N(B) M(B))
+// Tested:
+//   Fuzz Tested
+template <class T> Matrix<T> mulMatMod(const Matrix<T> &A, const Matrix<T> &B,
+                                       T mod, int threads = 1) {
+  static_assert(is_integral<T>::value, "T must be an integral type");
+  assert(getM(A) == getN(B) && mod > 0); int Mp = (getM(B) + 7) / 8 * 8;
+  Matrix<T> C = makeMatrix<T>(getN(A), getM(B)); if (mod == 1) return C;
+  if (uint64_t(mod) < (uint64_t(1) << 31)) {
+    using U = uint64_t; U m = mod, f = (U(1) << 32) % m;
+    U fmax = 0xFFFFFFFF + 0xFFFFFFFF * f;
+    int R = min((~U(0) - fmax) / ((m - 1) * (m - 1)), U(INT_MAX));
+    vector<uint32_t> Bp = padColumns<uint32_t>(B, Mp);
+    auto fold = [&] (U x) { return (x & 0xFFFFFFFF) + (x >> 32) * f; };
+    auto store = [&] (U x) { return T(x % m); };
+    forRowBlocks(getN(A), threads, [&] (int lo, int hi) {
+      mulMatRows<U>(A, Bp, Mp, C, lo, hi, R, fold, store);
+    });
+  } else {
+    using U = __uint128_t; U m = mod;
+    int R = min((~U(0) - m) / ((m - 1) * (m - 1)), U(INT_MAX));
+    vector<uint64_t> Bp = padColumns<uint64_t>(B, Mp);
+    auto fold = [&] (U x) { return x % m; };
+    auto store = [&] (U x) { return T(x % m); };
+    forRowBlocks(getN(A), threads, [&] (int lo, int hi) {
+      mulMatRows<U>(A, Bp, Mp, C, lo, hi, R, fold, store);
+    });
+  }
+  return C;
+}
+
+// Raises the square matrix A to the power of pow modulo mod,
+//   getN(A) must equal getM(A)
+// Template Arguments:
+//   T: the type of each element in the matrix, must be integral
+//   U: the type of pow
+// Function Arguments:
+//   A: the base square matrix with elements in the range [0, mod)
+//   pow: the power
+//   mod: the modulus, must be positive and less than 2^63
+//   threads: the maximum number of threads to use, only used if getN(A) is
+//     at least PARALLEL_CUTOFF
+// Return Value: the matrix A raised to the power pow modulo mod
+// In practice, has a very small constant
+// Time Complexity: O(N^3 log pow / threads)
+// Memory Complexity: O(N^2)
+// Tested:
+//   Fuzz Tested
+template <class T, class U>
+Matrix<T> powMatMod(Matrix<T> A, U pow, T mod, int threads = 1) {
+  assert(getN(A) == getM(A)); Matrix<T> x = makeMatrix<T>(getN(A), getN(A));
+  for (int i = 0; i < getN(A); i++) x[i][i] = T(1) % mod;
+  while (true) {
+    if (pow % 2 == 1) x = mulMatMod(x, A, mod, threads);
+    if ((pow /= 2) == 0) break;
+    A = mulMatMod(A, A, mod, threads);
+  }
+  return x;
+}
+
 // Computes the determinant of a square matrix A, getN(A) must equal getM(A)
 // Template Arguments:
 //   T: the type of each element in the matrix
@@ -226,10 +437,11 @@ template <class T> T det(Matrix<T> A) {
   for (int i = 0; i < N; i++) {
     int mx = i; for (int j = i + 1; j < N; j++)
       if (abs(A[j][i]) > abs(A[mx][i])) mx = j;
-    if (i != mx) { ret = -ret; A[i].swap(A[mx]); }
-    T inv = T(1) / A[i][i]; for (int j = i + 1; j < N; j++) {
-      T alpha = A[j][i] * inv;
-      for (int k = i + 1; k < N; k++) A[j][k] -= alpha * A[i][k];
+    if (i != mx) { ret = -ret; A.swapRows(i, mx); }
+    T inv = T(1) / A[i][i]; const T *ai = A[i];
+    for (int j = i + 1; j < N; j++) {
+      T alpha = A[j][i] * inv, *aj = A[j];
+      for (int k = i + 1; k < N; k++) aj[k] -= alpha * ai[k];
     }
   }
   for (int i = 0; i < N; i++) ret *= A[i][i];
@@ -257,7 +469,7 @@ template <class T> Matrix<T> invMat(Matrix<T> A, T EPS = T(1e-9)) {
     int mx = i; for (int j = i; j < N; j++)
       if (A[j][i] != 0) { mx = j; break; }
     if (abs(A[mx][i]) <= EPS) return makeMatrix<T>(0, 0);
-    if (i != mx) { A[i].swap(A[mx]); I[i].swap(I[mx]); }
+    if (i != mx) { A.swapRows(i, mx); I.swapRows(i, mx); }
     T inv = T(1) / A[i][i]; for (int k = i; k < N; k++) A[i][k] *= inv;
     for (int k = 0; k < N; k++) I[i][k] *= inv;
     for (int j = 0; j < N; j++) if (j != i) {
@@ -216,3 +216,132 @@ template <class Matroid1, class Matroid2> struct MatroidIntersection {
     for (int i = 0; i < N; i++) if (inSet[i]) independentSet.push_back(i);
   }
 };
+
+// Find the independent set with the maximum weight among all subsets of a
+//   ground set of N elements that are independent in both matroids, or the
+//   one with the maximum weight among those with the largest size
+// The weights are split as w = w1 + w2 where the current set has the maximum
+//   weight among sets of its size in the first matroid with respect to w1 and
+//   in the second matroid with respect to w2, so the exchange graph has non
+//   negative edge costs and each shortest augmenting path is found with
+//   Dijkstra's algorithm, after which the distances are reused as potentials
+//   to update w1 and w2
+// Exchange edges are evaluated lazily when a vertex is popped, and only
+//   towards vertices that have not been popped yet, where the exchange edges
+//   from an element not in the set are found one at a time by adding the
+//   element and the popped elements of the set before the rest, and the
+//   search stops as soon as the best augmenting path is known
+// A matroid must have the basic properties of:
+//   - the empty set is independent
+//   - any subset of an independent set is empty
+//   - if independent set A is smaller than independent set B, then there is
+//       at least 1 element of B can be added to A without loss of independency
+// Elements are 0-indexed
+// Template Arguments:
+//   Matroid1: the type of the first matroid
+//     Required Functions:
+//       clear(): clears all elements in the independent set of this matroid
+//       add(i): adds element i to the independent set of this matroid
+//       independent(i): returns whether adding element i to the current
+//         existing independent set would still result in an independent set
+//   Matroid2: the type of the second matroid
+//     Required Functions: same as Matroid1
+//   T: the type of the weights
+// Constructor Arguments:
+//   N: the number of elements in the ground set
+//   m1: an instance of the first matroid
+//   m2: an instance of the second matroid
+//   w: a vector of the weights of each element
+//   maxCardinality: whether the independent set should have the largest
+//     size, or only the maximum weight
+// Fields:
+//   N: the number of elements in the ground set
+//   weight: the weight of the independent set
+//   inSet: a vector of booleans indicating whether each element is in the
+//     independent set or not
+//   independentSet: a vector of the indices of the elements in the
+//     independent set
+//   w1: the weights for the first matroid
+//   w2: the weights for the second matroid
+//   maxWeight: maxWeight[k] is the maximum weight of an independent set of
+//     size k, for each size k up to the size of the independent set
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(I (N + I) (I + log N)) * (time complexity of m1.add,
+//     m2.add, m1.independent, and m2.independent) where I is the size of the
+//     independent set, and usually much less as only the exchange edges out
+//     of the vertices closer than the best augmenting path are evaluated
+// Memory Complexity: O(N + M1 + M2) where M1 and M2 are the memory
+//   complexities of m1 and m2
+// Tested:
+//   Fuzz Tested
+template <class Matroid1, class Matroid2, class T>
+struct WeightedMatroidIntersection {
+  int N; T weight; vector<bool> inSet; vector<int> independentSet;
+  vector<T> w1, w2, maxWeight;
+  bool augment(Matroid1 &m1, Matroid2 &m2, bool maxCardinality) {
+    vector<int> S, par(N, -1), len(N, 0); vector<T> d(N, T());
+    vector<bool> sink(N, false), done(N, false);
+    priority_queue<tuple<T, int, int>, vector<tuple<T, int, int>>,
+                   greater<tuple<T, int, int>>> PQ;
+    for (int i = 0; i < N; i++) if (inSet[i]) S.push_back(i);
+    m1.clear(); m2.clear(); for (int y : S) { m1.add(y); m2.add(y); }
+    T W = T(); bool hasSink = false; for (int x = 0; x < N; x++)
+      if (!inSet[x] && m2.independent(x)) {
+        W = hasSink ? max(W, w2[x]) : w2[x]; sink[x] = hasSink = true;
+      }
+    if (!hasSink) return false;
+    for (int x = 0; x < N; x++) if (!inSet[x] && m1.independent(x)) {
+      d[x] = -w1[x]; len[x] = 1; PQ.emplace(d[x], len[x], x);
+    }
+    int t = -1; T bd = T(); int bl = 0; auto relax = [&] (int v, int u, T du) {
+      if (len[u] == 0 || make_pair(du, len[v] + 1) < make_pair(d[u], len[u])) {
+        d[u] = du; len[u] = len[v] + 1; par[u] = v; PQ.emplace(du, len[u], u);
+      }
+    };
+    while (!PQ.empty()) {
+      T dv; int lv, v; tie(dv, lv, v) = PQ.top(); PQ.pop();
+      if (done[v] || dv != d[v] || lv != len[v]) continue;
+      if (t != -1 && !(make_pair(dv, lv) < make_pair(bd, bl))) break;
+      done[v] = true; if (inSet[v]) {
+        m1.clear(); for (int y : S) if (y != v) m1.add(y);
+        for (int x = 0; x < N; x++)
+          if (!inSet[x] && !done[x] && m1.independent(x))
+            relax(v, x, dv + w1[v] - w1[x]);
+      } else if (sink[v]) {
+        T c = dv + W - w2[v];
+        if (t == -1 || make_pair(c, lv) < make_pair(bd, bl)) {
+          t = v; bd = c; bl = lv;
+        }
+      } else {
+        vector<int> front, rest; for (int y : S)
+          (done[y] ? front : rest).push_back(y);
+        for (bool found = true; found;) {
+          m2.clear(); m2.add(v); found = false; bool full = true;
+          for (int y : front) {
+            if (!m2.independent(y)) { full = false; break; }
+            m2.add(y);
+          }
+          for (int k = 0; full && k < int(rest.size()); k++) {
+            int y = rest[k]; if (m2.independent(y)) { m2.add(y); continue; }
+            relax(v, y, dv + w2[y] - w2[v]); front.push_back(y);
+            rest.resize(k); found = true;
+          }
+        }
+      }
+    }
+    if (t == -1 || (!maxCardinality && !(bd - W < T()))) return false;
+    for (int v = 0; v < N; v++) {
+      T p = done[v] ? min(d[v], bd) : bd; w1[v] += p; w2[v] -= p;
+    }
+    for (int v = t; v != -1; v = par[v]) inSet[v] = !inSet[v];
+    weight -= bd - W; maxWeight.push_back(weight); return true;
+  }
+  WeightedMatroidIntersection(int N, Matroid1 m1, Matroid2 m2,
+                              const vector<T> &w, bool maxCardinality)
+      : N(N), weight(T()), inSet(N, false), w1(w), w2(N, T()),
+        maxWeight(1, T()) {
+    while (augment(m1, m2, maxCardinality));
+    for (int i = 0; i < N; i++) if (inSet[i]) independentSet.push_back(i);
+  }
+};
@@ -276,6 +276,52 @@ struct Montgomery {
   u128 mul(u128 a, u128 b) { return reduce(u256::mul(a, b)); }
 };
 
+// Struct supporting operations on unsigned 64-bit integers in Montgomery form
+//   with R = 2^64, where each product needs two 64-bit multiplications for the
+//   reduction instead of a 128-bit division
+// Constructor Arguments:
+//   mod: the modulo of the space, must be odd
+// Fields:
+//   one: the value 1 in Montgomery form
+// Functions:
+//   init(x): transforms a number into Montgomery form
+//   reduce(x): transforms a number from Montgomery form, or returns x / R
+//     modulo mod for any x less than mod * R
+//   mul(a, b): multiplies the numbers a and b in Montgomery form and returns
+//     their product modulo mod in Montgomery form
+//   add(a, b), sub(a, b): adds or subtracts the numbers a and b in Montgomery
+//     form and returns the result in Montgomery form
+//   pow(a, p): returns a in Montgomery form to the power of p in Montgomery
+//     form
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor, init, reduce, mul, add, sub: O(1)
+//   pow: O(log p)
+// Memory Complexity: O(1)
+// Tested:
+//   Fuzz Tested
+struct Montgomery64 {
+  using u64 = uint64_t; using u128 = __uint128_t;
+  u64 mod, inv, r2, one;
+  Montgomery64(u64 mod = 1)
+      : mod(mod), inv(mod), r2(-u128(mod) % mod), one(-mod % mod) {
+    for (int i = 0; i < 5; i++) inv *= 2 - mod * inv;
+  }
+  u64 reduce(u128 x) const {
+    u64 hi = x >> 64, t = (u128(u64(x) * inv) * mod) >> 64;
+    return hi < t ? hi - t + mod : hi - t;
+  }
+  u64 init(u64 x) const { return mul(x % mod, r2); }
+  u64 mul(u64 a, u64 b) const { return reduce(u128(a) * b); }
+  u64 add(u64 a, u64 b) const { return a >= mod - b ? a - (mod - b) : a + b; }
+  u64 sub(u64 a, u64 b) const { return a < b ? a - b + mod : a - b; }
+  template <class U> u64 pow(u64 a, U p) const {
+    u64 x = one; for (; p > 0; p >>= 1, a = mul(a, a))
+      if (p & 1) x = mul(x, a);
+    return x;
+  }
+};
+
 // Multiplies two unsigned 128-bit integers a and b modulo mod even if a * b
 //   overflows, using Montgomery reduction
 // Function Arguments:
@@ -1,5 +1,8 @@
 #pragma once
 #include <bits/stdc++.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 #include "ModularArithmetic.h"
 #include "Primes.h"
 using namespace std;
@@ -18,11 +21,13 @@ template <class T> T primitiveRoot(T p) {
   return -1;
 }
 
-// Number Theoretic Transform
+// Precomputed roots of unity and bit reversal permutation for the Number
+//   Theoretic Transform of any power of 2 size up to N
+// Can be shared between threads as all functions are read only
 // Template Arguments:
 //   T: the type of the integer, must be integral
 //   MOD: the value to mod by, must be in the form C * 2^K + 1 for some
-//       integers C, K where size(a) <= 2^K
+//       integers C, K where N <= 2^K
 //     Sample Mods:
 //       998244353 = 119 * 2^23 + 1, primitiveRoot = 3
 //       754974721 = 45 * 2^24 + 1, primitiveRoot = 11
@@ -30,36 +35,73 @@ template <class T> T primitiveRoot(T p) {
 //       469762049 = 7 * 2^26 + 1, primitiveRoot = 3
 //       1004535809 = 479 * 2^21 + 1, primitiveRoot = 3
 //       1012924417 = 483 * 2^21 + 1, primitiveRoot = 5
-// Function Arguments:
-//   a: a reference to the vector of type T in the range [0, MOD)
-// In practice, has a moderate constant, faster than FFT and Karatsuba
-// Time Complexity: O(N log N) where N = size(a)
+// Constructor Arguments:
+//   N: the maximum size of the transform, must be a power of 2
+// Fields:
+//   N: the maximum size of the transform
+//   rt: the roots of unity, where rt[k + j] for 0 <= j < k is the j-th power
+//     of the 2k-th principal root of unity modulo MOD
+//   ord: the bit reversal permutation for size N
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(N + sqrt MOD)
 // Memory Complexity: O(N)
 // Tested:
-//   https://judge.yosupo.jp/problem/convolution_mod
-//   https://judge.yosupo.jp/problem/convolution_mod_1000000007
-template <class T, const T MOD> void ntt(vector<T> &a) {
+//   Fuzz Tested
+template <class T, const T MOD> struct NTTPlan {
   static_assert(is_integral<T>::value, "T must be an integral type");
   static_assert(is_signed<T>::value, "T must be a signed type");
 #if __cplusplus >= 201402L
   static_assert(isPrime(MOD), "MOD must be prime");
 #endif
-  static T pk = 1, PK = 0;
-  for (; pk < MOD; pk *= 2) if ((MOD - 1) % pk == 0) PK = pk;
-  assert(PK != 0 && "MOD must be of the form C * 2^K + 1");
-  static T ROOT = powMod(primitiveRoot(MOD), (MOD - 1) / PK, MOD);
-  static vector<T> rt(2, 1); static vector<int> ord; static int k = 2, len = 1;
-  int N = a.size(); assert(N <= PK); assert(!(N & (N - 1)));
-  for (; k < N; k <<= 1, len++) {
-    rt.resize(N, T()); T x = powMod(ROOT, PK >> (len + 1), MOD);
-    for (int i = k; i < (k << 1); i++)
-      rt[i] = i & 1 ? mulMod(rt[i >> 1], x, MOD) : rt[i >> 1];
-  }
-  if (int(ord.size()) != N) {
-    ord.assign(N, 0); int len = __builtin_ctz(N); for (int i = 0; i < N; i++)
+  int N; vector<T> rt; vector<int> ord;
+  NTTPlan(int N = 1) : N(N), rt(max(N, 2), 1), ord(N, 0) {
+    assert(N > 0 && !(N & (N - 1))); T PK = 0;
+    for (T pk = 1; pk < MOD; pk *= 2) if ((MOD - 1) % pk == 0) PK = pk;
+    assert(PK != 0 && "MOD must be of the form C * 2^K + 1"); assert(N <= PK);
+    T ROOT = powMod(primitiveRoot(MOD), (MOD - 1) / PK, MOD);
+    for (int k = 2, len = 1; k < N; k <<= 1, len++) {
+      T x = powMod(ROOT, PK >> (len + 1), MOD);
+      for (int i = k; i < (k << 1); i++)
+        rt[i] = i & 1 ? mulMod(rt[i >> 1], x, MOD) : rt[i >> 1];
+    }
+    int len = __builtin_ctz(N); for (int i = 1; i < N; i++)
       ord[i] = (ord[i >> 1] >> 1) + ((i & 1) << (len - 1));
   }
-  for (int i = 0; i < N; i++) if (i < ord[i]) swap(a[i], a[ord[i]]);
+};
+
+// Returns a thread local NTTPlan with a size of at least N, which is only
+//   rebuilt when a larger size is required
+template <class T, const T MOD> const NTTPlan<T, MOD> &defaultNTTPlan(int N) {
+  thread_local NTTPlan<T, MOD> plan;
+  if (plan.N < N) plan = NTTPlan<T, MOD>(N);
+  return plan;
+}
+
+// Number Theoretic Transform
+// Template Arguments:
+//   T: the type of the integer, must be integral
+//   MOD: the value to mod by, must be in the form C * 2^K + 1 for some
+//       integers C, K where size(a) <= 2^K, see NTTPlan for sample mods
+// Function Arguments:
+//   a: a reference to the vector of type T in the range [0, MOD)
+//   plan: the NTTPlan to use, must have a size of at least size(a); if not
+//     provided, a thread local plan is used, so the function is reentrant
+// In practice, has a moderate constant, faster than FFT and Karatsuba
+// Time Complexity: O(N log N) where N = size(a)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+//   https://judge.yosupo.jp/problem/convolution_mod
+//   https://judge.yosupo.jp/problem/convolution_mod_1000000007
+template <class T, const T MOD>
+void ntt(vector<T> &a, const NTTPlan<T, MOD> &plan) {
+  int N = a.size(); assert(!(N & (N - 1))); assert(N <= plan.N);
+  const vector<T> &rt = plan.rt; const vector<int> &ord = plan.ord;
+  int shift = N == 0 ? 0 : __builtin_ctz(plan.N) - __builtin_ctz(N);
+  for (int i = 0; i < N; i++) {
+    int j = ord[i] >> shift; if (i < j) swap(a[i], a[j]);
+  }
   for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1)
     for (int j = 0; j < len; j++) {
       T u = a[i + j], v = mulMod(a[len + i + j], rt[len + j], MOD);
@@ -67,6 +109,276 @@ template <class T, const T MOD> void ntt(vector<T> &a) {
     }
 }
 
+template <class T, const T MOD> void ntt(vector<T> &a) {
+  ntt(a, defaultNTTPlan<T, MOD>(a.size()));
+}
+
+// Number Theoretic Transform using 32-bit Montgomery multiplication and
+//   radix-4 butterflies, vectorized with AVX2 if __AVX2__ is defined
+// Values are kept in the range [0, 2 * MOD) between butterflies, and no bit
+//   reversal permutation is done: the forward transform returns its result
+//   in bit reversed order and the inverse transform takes its input in bit
+//   reversed order
+// Template Arguments:
+//   MOD: the value to mod by, must be a prime less than 2^30 in the form
+//       C * 2^K + 1 for some integers C, K where size(a) <= 2^K
+// Functions:
+//   mul(a, b): returns a * b * 2^-32 modulo MOD, in the range [0, 2 * MOD),
+//     for a and b in the range [0, 2 * MOD)
+//   forward(a): performs the forward transform on a, where size(a) is a
+//     power of 2 and all values are in the range [0, 2 * MOD), the result
+//     is in bit reversed order with all values in the range [0, 2 * MOD)
+//   inverse(a): performs the inverse transform on a, without dividing by
+//     size(a), where a is in bit reversed order, the result is in natural
+//     order with all values in the range [0, 2 * MOD)
+//   multiply(a, b, eq): replaces a with the cyclic convolution of a and b
+//     where size(a) = size(b) is a power of 2, all values are in the range
+//     [0, MOD), and eq indicates whether a and b are equal; b is
+//     modified, and the result is in the range [0, MOD)
+// Can be shared between threads as all functions are read only
+// In practice, has a small constant, and is faster than ntt
+// Time Complexity:
+//   constructor: O(log MOD)
+//   mul: O(1)
+//   forward, inverse, multiply: O(N log N)
+// Memory Complexity: O(log MOD)
+// Tested:
+//   Stress Tested
+template <const uint32_t MOD> struct NTTMontgomery {
+  static_assert(MOD % 2 == 1 && MOD < (uint32_t(1) << 30),
+                "MOD must be an odd prime less than 2^30");
+  int K; uint32_t MOD2, NINV, R2, IMAG, IIMAG;
+  vector<uint32_t> rate2, irate2, rate3, irate3;
+  uint32_t mul(uint32_t a, uint32_t b) const {
+    uint64_t x = uint64_t(a) * b; uint32_t m = uint32_t(x) * NINV;
+    return (x + uint64_t(m) * MOD) >> 32;
+  }
+  uint32_t add(uint32_t a, uint32_t b) const {
+    uint32_t x = a + b; return x >= MOD2 ? x - MOD2 : x;
+  }
+  uint32_t sub(uint32_t a, uint32_t b) const {
+    uint32_t x = a + MOD2 - b; return x >= MOD2 ? x - MOD2 : x;
+  }
+  uint32_t pow(uint32_t a, uint64_t p) const {
+    uint32_t ret = mul(1, R2); for (; p > 0; p >>= 1, a = mul(a, a))
+      if (p & 1) ret = mul(ret, a);
+    return ret;
+  }
+#ifdef __AVX2__
+  __m256i mul(__m256i a, __m256i b) const {
+    __m256i m = _mm256_set1_epi32(MOD), ni = _mm256_set1_epi32(NINV);
+    __m256i pe = _mm256_mul_epu32(a, b), po = _mm256_mul_epu32(
+        _mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    __m256i qe = _mm256_mul_epu32(_mm256_mul_epu32(pe, ni), m);
+    __m256i qo = _mm256_mul_epu32(_mm256_mul_epu32(po, ni), m);
+    return _mm256_blend_epi32(
+        _mm256_srli_epi64(_mm256_add_epi64(pe, qe), 32),
+        _mm256_add_epi64(po, qo), 0xAA);
+  }
+  __m256i add(__m256i a, __m256i b) const {
+    __m256i x = _mm256_add_epi32(a, b);
+    return _mm256_min_epu32(x, _mm256_sub_epi32(x, _mm256_set1_epi32(MOD2)));
+  }
+  __m256i sub(__m256i a, __m256i b) const {
+    __m256i m2 = _mm256_set1_epi32(MOD2);
+    __m256i x = _mm256_add_epi32(_mm256_sub_epi32(a, b), m2);
+    return _mm256_min_epu32(x, _mm256_sub_epi32(x, m2));
+  }
+  static __m256i load(const uint32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static void store(uint32_t *p, __m256i x) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), x);
+  }
+#endif
+  NTTMontgomery() : K(__builtin_ctz(MOD - 1)), MOD2(MOD * 2), NINV(MOD) {
+    for (int i = 0; i < 4; i++) NINV *= 2 - MOD * NINV;
+    NINV = -NINV; R2 = (uint64_t(1) << 32) % MOD;
+    R2 = uint64_t(R2) * R2 % MOD;
+    vector<uint32_t> rt(K + 1), irt(K + 1);
+    uint32_t g = mul(uint32_t(primitiveRoot<long long>(MOD)), R2);
+    rt[K] = pow(g, (MOD - 1) >> K); irt[K] = pow(rt[K], MOD - 2);
+    for (int i = K - 1; i >= 0; i--) {
+      rt[i] = mul(rt[i + 1], rt[i + 1]); irt[i] = mul(irt[i + 1], irt[i + 1]);
+    }
+    IMAG = K >= 2 ? rt[2] : 0; IIMAG = K >= 2 ? irt[2] : 0;
+    for (int d = 2; d <= 3; d++) {
+      vector<uint32_t> &r = d == 2 ? rate2 : rate3;
+      vector<uint32_t> &ir = d == 2 ? irate2 : irate3;
+      uint32_t prod = mul(1, R2), iprod = prod;
+      for (int i = 0; i <= K - d; i++) {
+        r.push_back(mul(rt[i + d], prod));
+        ir.push_back(mul(irt[i + d], iprod));
+        prod = mul(prod, irt[i + d]); iprod = mul(iprod, rt[i + d]);
+      }
+    }
+  }
+  void forward(vector<uint32_t> &a) const {
+    int N = a.size(), H = __builtin_ctz(N); assert(H <= K);
+    assert(!(N & (N - 1))); uint32_t *A = a.data(), one = mul(1, R2);
+    for (int len = 0; len < H;) {
+      if (H - len == 1) {
+        int p = 1 << (H - len - 1); uint32_t rot = one;
+        for (int s = 0; s < (1 << len); s++) {
+          uint32_t *x = A + (s << (H - len)), *y = x + p; int i = 0;
+#ifdef __AVX2__
+          __m256i vr = _mm256_set1_epi32(rot); for (; i + 8 <= p; i += 8) {
+            __m256i l = load(x + i), r = mul(load(y + i), vr);
+            store(x + i, add(l, r)); store(y + i, sub(l, r));
+          }
+#endif
+          for (; i < p; i++) {
+            uint32_t l = x[i], r = mul(y[i], rot);
+            x[i] = add(l, r); y[i] = sub(l, r);
+          }
+          if (s + 1 != (1 << len)) rot = mul(rot, rate2[__builtin_ctz(~s)]);
+        }
+        len++;
+      } else {
+        int p = 1 << (H - len - 2); uint32_t rot = one;
+        for (int s = 0; s < (1 << len); s++) {
+          uint32_t rot2 = mul(rot, rot), rot3 = mul(rot2, rot);
+          uint32_t *x0 = A + (s << (H - len)), *x1 = x0 + p, *x2 = x1 + p;
+          uint32_t *x3 = x2 + p; int i = 0;
+#ifdef __AVX2__
+          __m256i vr1 = _mm256_set1_epi32(rot), vr2 = _mm256_set1_epi32(rot2);
+          __m256i vr3 = _mm256_set1_epi32(rot3);
+          __m256i vim = _mm256_set1_epi32(IMAG); for (; i + 8 <= p; i += 8) {
+            __m256i a0 = load(x0 + i), a1 = mul(load(x1 + i), vr1);
+            __m256i a2 = mul(load(x2 + i), vr2), a3 = mul(load(x3 + i), vr3);
+            __m256i s02 = add(a0, a2), d02 = sub(a0, a2), s13 = add(a1, a3);
+            __m256i t = mul(sub(a1, a3), vim);
+            store(x0 + i, add(s02, s13)); store(x1 + i, sub(s02, s13));
+            store(x2 + i, add(d02, t)); store(x3 + i, sub(d02, t));
+          }
+#endif
+          for (; i < p; i++) {
+            uint32_t a0 = x0[i], a1 = mul(x1[i], rot), a2 = mul(x2[i], rot2);
+            uint32_t a3 = mul(x3[i], rot3), s02 = add(a0, a2);
+            uint32_t d02 = sub(a0, a2), s13 = add(a1, a3);
+            uint32_t t = mul(sub(a1, a3), IMAG);
+            x0[i] = add(s02, s13); x1[i] = sub(s02, s13);
+            x2[i] = add(d02, t); x3[i] = sub(d02, t);
+          }
+          if (s + 1 != (1 << len)) rot = mul(rot, rate3[__builtin_ctz(~s)]);
+        }
+        len += 2;
+      }
+    }
+  }
+  void inverse(vector<uint32_t> &a) const {
+    int N = a.size(), H = __builtin_ctz(N); assert(H <= K);
+    assert(!(N & (N - 1))); uint32_t *A = a.data(), one = mul(1, R2);
+    for (int len = H; len > 0;) {
+      if (len == 1) {
+        int p = 1 << (H - len); uint32_t irot = one;
+        for (int s = 0; s < (1 << (len - 1)); s++) {
+          uint32_t *x = A + (s << (H - len + 1)), *y = x + p; int i = 0;
+#ifdef __AVX2__
+          __m256i vr = _mm256_set1_epi32(irot); for (; i + 8 <= p; i += 8) {
+            __m256i l = load(x + i), r = load(y + i);
+            store(x + i, add(l, r)); store(y + i, mul(sub(l, r), vr));
+          }
+#endif
+          for (; i < p; i++) {
+            uint32_t l = x[i], r = y[i];
+            x[i] = add(l, r); y[i] = mul(sub(l, r), irot);
+          }
+          if (s + 1 != (1 << (len - 1)))
+            irot = mul(irot, irate2[__builtin_ctz(~s)]);
+        }
+        len--;
+      } else {
+        int p = 1 << (H - len); uint32_t irot = one;
+        for (int s = 0; s < (1 << (len - 2)); s++) {
+          uint32_t irot2 = mul(irot, irot), irot3 = mul(irot2, irot);
+          uint32_t *x0 = A + (s << (H - len + 2)), *x1 = x0 + p, *x2 = x1 + p;
+          uint32_t *x3 = x2 + p; int i = 0;
+#ifdef __AVX2__
+          __m256i vr1 = _mm256_set1_epi32(irot);
+          __m256i vr2 = _mm256_set1_epi32(irot2);
+          __m256i vr3 = _mm256_set1_epi32(irot3);
+          __m256i vim = _mm256_set1_epi32(IIMAG); for (; i + 8 <= p; i += 8) {
+            __m256i a0 = load(x0 + i), a1 = load(x1 + i);
+            __m256i a2 = load(x2 + i), a3 = load(x3 + i);
+            __m256i s01 = add(a0, a1), d01 = sub(a0, a1), s23 = add(a2, a3);
+            __m256i t = mul(sub(a2, a3), vim);
+            store(x0 + i, add(s01, s23)); store(x1 + i, mul(add(d01, t), vr1));
+            store(x2 + i, mul(sub(s01, s23), vr2));
+            store(x3 + i, mul(sub(d01, t), vr3));
+          }
+#endif
+          for (; i < p; i++) {
+            uint32_t a0 = x0[i], a1 = x1[i], a2 = x2[i], a3 = x3[i];
+            uint32_t s01 = add(a0, a1), d01 = sub(a0, a1), s23 = add(a2, a3);
+            uint32_t t = mul(sub(a2, a3), IIMAG);
+            x0[i] = add(s01, s23); x1[i] = mul(add(d01, t), irot);
+            x2[i] = mul(sub(s01, s23), irot2); x3[i] = mul(sub(d01, t), irot3);
+          }
+          if (s + 1 != (1 << (len - 2)))
+            irot = mul(irot, irate3[__builtin_ctz(~s)]);
+        }
+        len -= 2;
+      }
+    }
+  }
+  void multiply(vector<uint32_t> &a, vector<uint32_t> &b, bool eq) const {
+    int N = a.size(); forward(a); if (!eq) forward(b);
+    const vector<uint32_t> &c = eq ? a : b; int i = 0;
+#ifdef __AVX2__
+    for (; i + 8 <= N; i += 8)
+      store(a.data() + i, mul(load(a.data() + i), load(c.data() + i)));
+#endif
+    for (; i < N; i++) a[i] = mul(a[i], c[i]);
+    inverse(a); uint32_t f = mul(pow(mul(N, R2), MOD - 2), R2); i = 0;
+#ifdef __AVX2__
+    __m256i vf = _mm256_set1_epi32(f), m = _mm256_set1_epi32(MOD);
+    for (; i + 8 <= N; i += 8) {
+      __m256i x = mul(load(a.data() + i), vf);
+      store(a.data() + i, _mm256_min_epu32(x, _mm256_sub_epi32(x, m)));
+    }
+#endif
+    for (; i < N; i++) { a[i] = mul(a[i], f); if (a[i] >= MOD) a[i] -= MOD; }
+  }
+};
+
+// Helper functions for mulPolyNTT to compute the cyclic convolution of a and
+//   b of size N, using NTTMontgomery if MOD < 2^30, and ntt otherwise
+template <class T, const T MOD>
+vector<T> cyclicConvNTT(const vector<T> &a, const vector<T> &b, int N,
+                        bool eq, false_type) {
+  vector<T> fa(N, T()), fb, res(N, T());
+  copy(a.begin(), a.end(), fa.begin()); ntt<T, MOD>(fa); if (eq) fb = fa;
+  else {
+    fb.assign(N, T()); copy(b.begin(), b.end(), fb.begin()); ntt<T, MOD>(fb);
+  }
+  T invN = mulInvModPrime(T(N), MOD);
+  res[0] = mulMod(mulMod(fa[0], fb[0], MOD), invN, MOD);
+  for (int i = 1; i < N; i++)
+    res[N - i] = mulMod(mulMod(fa[i], fb[i], MOD), invN, MOD);
+  ntt<T, MOD>(res); return res;
+}
+
+// Helper function to compute the cyclic convolution of a and b of size N
+//   modulo a prime P < 2^30 using NTTMontgomery
+template <const uint32_t P, class T>
+vector<uint32_t> cyclicConvMontgomery(const vector<T> &a, const vector<T> &b,
+                                      int N, bool eq) {
+  static const NTTMontgomery<P> E; vector<uint32_t> fa(N, 0), fb;
+  for (int i = 0; i < int(a.size()); i++) fa[i] = a[i] % P;
+  if (!eq) {
+    fb.assign(N, 0); for (int i = 0; i < int(b.size()); i++) fb[i] = b[i] % P;
+  }
+  E.multiply(fa, fb, eq); return fa;
+}
+
+template <class T, const T MOD>
+vector<T> cyclicConvNTT(const vector<T> &a, const vector<T> &b, int N,
+                        bool eq, true_type) {
+  vector<uint32_t> res = cyclicConvMontgomery<uint32_t(MOD)>(a, b, N, eq);
+  return vector<T>(res.begin(), res.end());
+}
+
 // Polynomial Multiplication
 // Template Arguments:
 //   T: the type of the integer, must be integral
@@ -81,10 +393,13 @@ template <class T, const T MOD> void ntt(vector<T> &a) {
 //     of ntt calls)
 // Return Value: a vector of type T representing the polynomial a times b with
 //   no trailing zeros, all value in the range [0, MOD)
-// In practice, has a moderate constant
+// Reentrant, as all transforms use either thread local or read only tables
+// In practice, has a small constant if MOD < 2^30 as NTTMontgomery is used,
+//   and a moderate constant otherwise
 // Time Complexity: O(N log N) where N = size(a) + size(b)
 // Memory Complexity: O(N)
 // Tested:
+//   Stress Tested
 //   https://judge.yosupo.jp/problem/convolution_mod
 //   https://judge.yosupo.jp/problem/convolution_mod_1000000007
 const int NTT_CUTOFF = 30000;
@@ -99,16 +414,64 @@ vector<T> mulPolyNTT(const vector<T> &a, const vector<T> &b, bool eq = false) {
     return res;
   }
   while (N & (N - 1)) N++;
-  vector<T> fa(N, T()), fb, res(N, T());
-  copy(a.begin(), a.end(), fa.begin()); ntt<T, MOD>(fa); if (eq) fb = fa;
-  else {
-    fb.assign(N, T()); copy(b.begin(), b.end(), fb.begin()); ntt<T, MOD>(fb);
+  vector<T> res = cyclicConvNTT<T, MOD>(
+      a, b, N, eq, integral_constant<bool, (MOD < (T(1) << 30))>());
+  while (int(res.size()) > 1 && res.back() == T()) res.pop_back();
+  return res;
+}
+
+// Polynomial Multiplication for an arbitrary modulus by computing the product
+//   modulo the primes 998244353, 167772161, and 469762049 with NTTMontgomery
+//   and combining the results with Garner's algorithm
+// Template Arguments:
+//   T: the type of the integer, must be integral
+//   MOD: the value to mod by, must be positive, and MOD * MOD must not
+//     overflow
+// Functions Arguments:
+//   a: a vector of type T representing the first polynomial, a[i] stores
+//     the coefficient of x^i, must be in the range [0, MOD)
+//   b: a vector of type T representing the second polynomial, b[i] stores
+//     the coefficient of x^i, must be in the range [0, MOD)
+//   eq: a boolean indicating whether a and b are equal (to reuse the forward
+//     transforms)
+// Return Value: a vector of type T representing the polynomial a times b with
+//   no trailing zeros, all value in the range [0, MOD), only guaranteed to
+//   be correct if min(size(a), size(b)) * (MOD - 1)^2 is less than
+//   998244353 * 167772161 * 469762049 (approximately 7.5 * 10^25), and
+//   size(a) + size(b) - 1 <= 2^23
+// In practice, has a moderate constant, faster and more precise than
+//   mulPolyFFT
+// Time Complexity: O(N log N) where N = size(a) + size(b)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+template <class T, const T MOD>
+vector<T> mulPolyAnyMod(const vector<T> &a, const vector<T> &b,
+                        bool eq = false) {
+  static_assert(is_integral<T>::value, "T must be an integral type");
+  static_assert(0 < MOD, "MOD must be a positive integer");
+  int N = max(0, int(a.size()) + int(b.size()) - 1);
+  if ((long long)(a.size()) * (long long)(b.size()) <= NTT_CUTOFF) {
+    vector<T> res(N, T()); for (int i = 0; i < int(a.size()); i++)
+      for (int j = 0; j < int(b.size()); j++)
+        res[i + j] = addMod(res[i + j], mulMod(a[i], b[j], MOD), MOD);
+    while (int(res.size()) > 1 && res.back() == T()) res.pop_back();
+    return res;
+  }
+  const uint64_t P1 = 998244353, P2 = 167772161, P3 = 469762049;
+  static const uint64_t I12 = mulInvModPrime(P1 % P2, P2);
+  static const uint64_t I123 = mulInvModPrime(P1 * P2 % P3, P3);
+  static const T P12 = T(P1 * P2 % uint64_t(MOD));
+  while (N & (N - 1)) N++;
+  vector<uint32_t> r1 = cyclicConvMontgomery<P1>(a, b, N, eq);
+  vector<uint32_t> r2 = cyclicConvMontgomery<P2>(a, b, N, eq);
+  vector<uint32_t> r3 = cyclicConvMontgomery<P3>(a, b, N, eq);
+  vector<T> res(N, T()); for (int i = 0; i < N; i++) {
+    uint64_t v1 = r1[i], v2 = (r2[i] + P2 - v1 % P2) * I12 % P2;
+    uint64_t x = v1 + v2 * P1, v3 = (r3[i] + P3 - x % P3) * I123 % P3;
+    T lo = T(x % uint64_t(MOD)), hi = T(v3 % uint64_t(MOD));
+    res[i] = addMod(lo, mulMod(hi, P12, MOD), MOD);
   }
-  T invN = mulInvModPrime(T(N), MOD);
-  res[0] = mulMod(mulMod(fa[0], fb[0], MOD), invN, MOD);
-  for (int i = 1; i < N; i++)
-    res[N - i] = mulMod(mulMod(fa[i], fb[i], MOD), invN, MOD);
-  ntt<T, MOD>(res);
   while (int(res.size()) > 1 && res.back() == T()) res.pop_back();
   return res;
 }
@@ -255,6 +255,206 @@ template <class T, class F> void segmentedSieve(T lo, T hi, F f) {
   for (T i = 0; i < hi - lo + 1; i++) if (!p2[i]) f(lo + i);
 }
 
+const int WHEEL_RESIDUES[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+const int WHEEL_SEGMENT = 1 << 15, WHEEL_PRESIEVE = 7 * 11 * 13 * 17;
+
+// Helper for wheelSieve and wheelSieveCount that sieves the integers in the
+//   range [lo, hi] over a mod 30 wheel, where byte i represents the 8
+//   integers 30i + WHEEL_RESIDUES[j] and bit j is set if that integer is a
+//   prime that is at least 7 and in the range [lo, hi]
+// The bytes are sieved in segments of WHEEL_SEGMENT bytes to fit in the L1
+//   cache, and the segments are split into contiguous blocks between the
+//   given number of threads, each with its own buffer
+// The multiples p * m of a sieving prime p with m in the same residue class
+//   modulo 30 all lie on the same bit and are exactly p bytes apart, so each
+//   prime is crossed off as 8 progressions with a fixed mask, and the
+//   primes 7, 11, 13, 17 are removed by copying a precomputed pattern that
+//   repeats every WHEEL_PRESIEVE bytes
+// Function Arguments:
+//   lo: the inclusive lower bound
+//   hi: the inclusive upper bound
+//   threads: the maximum number of threads to use
+//   g(t, seg, base, len): the function to call for each segment from the
+//     thread with index t, where seg points to the len bytes starting at
+//     byte base, followed by zero bytes up to a multiple of 8
+// Time Complexity: O(sqrt(hi) + (hi - lo) log log hi)
+// Memory Complexity: O(sqrt(hi) + threads WHEEL_SEGMENT)
+template <class G>
+void wheelSieveSegments(long long lo, long long hi, int threads, G g) {
+  lo = max(lo, 7LL); if (lo > hi) return;
+  int sqrtHi = sqrtl(hi) + 2; while ((long long)(sqrtHi) * sqrtHi > hi)
+    sqrtHi--;
+  vector<int> P, idx(30, -1); for (int j = 0; j < 8; j++)
+    idx[WHEEL_RESIDUES[j]] = j;
+  Sieve(sqrtHi, [&] (int p) { if (p >= 19) P.push_back(p); });
+  static const vector<uint8_t> pre = [&] {
+    vector<uint8_t> ret(WHEEL_PRESIEVE, 0xFF);
+    for (int n = 0; n < WHEEL_PRESIEVE * 30; n++)
+      if (idx[n % 30] >= 0 && (n % 7 == 0 || n % 11 == 0 || n % 13 == 0
+                                        || n % 17 == 0))
+        ret[n / 30] &= ~(1 << idx[n % 30]);
+    return ret;
+  }();
+  long long s0 = lo / 30, s1 = hi / 30 + 1, nb = s1 - s0;
+  long long B = max((nb + max(threads, 1) - 1) / max(threads, 1),
+                    (long long)(WHEEL_SEGMENT));
+  B = (B + WHEEL_SEGMENT - 1) / WHEEL_SEGMENT * WHEEL_SEGMENT;
+  auto run = [&] (int t, long long a, long long b) {
+    int K = P.size(); vector<long long> nxt(K * 8);
+    vector<uint8_t> buf(WHEEL_SEGMENT + 8), msk(K * 8);
+    for (int k = 0; k < K; k++) for (int j = 0; j < 8; j++) {
+      long long p = P[k], m = max(p, (a * 30 + p - 1) / p);
+      m += ((WHEEL_RESIDUES[j] - m % 30) % 30 + 30) % 30;
+      nxt[k * 8 + j] = p * m / 30; msk[k * 8 + j] = ~(1 << idx[p * m % 30]);
+    }
+    for (long long s = a; s < b; s += WHEEL_SEGMENT) {
+      int len = min(b - s, (long long)(WHEEL_SEGMENT));
+      for (int i = 0, o = s % WHEEL_PRESIEVE; i < len;) {
+        int c = min(len - i, WHEEL_PRESIEVE - o);
+        memcpy(buf.data() + i, pre.data() + o, c); i += c; o = 0;
+      }
+      fill(buf.begin() + len, buf.end(), 0);
+      long long e = s + len; for (int k = 0; k < K; k++) {
+        long long p = P[k]; if (p * p >= e * 30) break;
+        for (int j = 0; j < 8; j++) {
+          long long o = nxt[k * 8 + j]; uint8_t m = msk[k * 8 + j];
+          for (; o < e; o += p) buf[o - s] &= m;
+          nxt[k * 8 + j] = o;
+        }
+      }
+      if (s == 0) buf[0] = (buf[0] & ~1) | 0x1E;
+      for (int j = 0; j < 8; j++) {
+        if (s == s0 && s0 * 30 + WHEEL_RESIDUES[j] < lo)
+          buf[0] &= ~(1 << j);
+        if (e == s1 && (s1 - 1) * 30 + WHEEL_RESIDUES[j] > hi)
+          buf[len - 1] &= ~(1 << j);
+      }
+      g(t, buf.data(), s, len);
+    }
+  };
+  vector<thread> ts; int t = 0;
+  for (long long a = s0 + B; a < s1; a += B)
+    ts.emplace_back(run, ++t, a, min(s1, a + B));
+  run(0, s0, min(s1, s0 + B)); for (auto &&th : ts) th.join();
+}
+
+// Segmented Sieve of Eratosthenes over a mod 30 wheel to identify primes
+//   between lo and hi, using L1 cache sized segments split between threads
+// Template Arguments:
+//   F: the type of f
+// Functions Arguments:
+//   lo: the inclusive lower bound
+//   hi: the inclusive upper bound
+//   f(i): the function to run a callback on for each prime i, in increasing
+//     order if threads is 1, otherwise each thread calls f on the primes in
+//     a contiguous block in increasing order concurrently with the others
+//   threads: the maximum number of threads to use
+// In practice, has a very small constant
+// Time Complexity: O(sqrt(hi) + (hi - lo) log log hi)
+// Memory Complexity: O(sqrt(hi) + threads)
+// Tested:
+//   Fuzz Tested
+template <class F>
+void wheelSieve(long long lo, long long hi, F f, int threads = 1) {
+  for (long long p : {2, 3, 5}) if (lo <= p && p <= hi) f(p);
+  wheelSieveSegments(lo, hi, threads, [&] (int, const uint8_t *seg,
+                                           long long base, int len) {
+    for (int i = 0; i < len; i += 8) {
+      uint64_t w; memcpy(&w, seg + i, 8); for (; w; w &= w - 1) {
+        int k = __builtin_ctzll(w);
+        f((base + i + k / 8) * 30 + WHEEL_RESIDUES[k % 8]);
+      }
+    }
+  });
+}
+
+// Counts the primes between lo and hi with a segmented Sieve of Eratosthenes
+//   over a mod 30 wheel, using L1 cache sized segments split between threads
+// Functions Arguments:
+//   lo: the inclusive lower bound
+//   hi: the inclusive upper bound
+//   threads: the maximum number of threads to use
+// Return Value: the number of primes in the range [lo, hi]
+// In practice, has a very small constant
+// Time Complexity: O(sqrt(hi) + (hi - lo) log log hi)
+// Memory Complexity: O(sqrt(hi) + threads)
+// Tested:
+//   Fuzz Tested
+long long wheelSieveCount(long long lo, long long hi, int threads = 1) {
+  long long ret = 0; for (long long p : {2, 3, 5}) ret += lo <= p && p <= hi;
+  vector<long long> cnt(max(threads, 1), 0);
+  wheelSieveSegments(lo, hi, threads, [&] (int t, const uint8_t *seg,
+                                           long long, int len) {
+    long long c = 0; for (int i = 0; i < len; i += 8) {
+      uint64_t w; memcpy(&w, seg + i, 8); c += __builtin_popcountll(w);
+    }
+    cnt[t] += c;
+  });
+  for (long long c : cnt) ret += c;
+  return ret;
+}
+
+// Computes pi(N), the number of primes less than or equal to N, with
+//   Lucy_Hedgehog's algorithm restricted to odd integers, followed by a
+//   Meissel-Lehmer style correction
+// Let S(x) be the number of odd integers in the range (1, x] that are
+//   either prime or have no prime factor less than or equal to p, then S is
+//   maintained for all x of the form N / i after sieving by each odd prime
+//   p with p^4 <= N, for the small values in an array indexed by x, and for
+//   the large values only at the rough i (integers with no odd prime factor
+//   of at most p) which are the only ones that are needed
+// Once p exceeds N^(1/4), each remaining composite counted by S(N) has
+//   exactly 2 or 3 prime factors greater than p, and these are subtracted
+//   using the values S(N / q) and S(N / (q r)) for primes q, r
+// Template Arguments:
+//   T: the type of N
+// Function Arguments:
+//   N: the bound, must be at most 10^15 so that the quotients computed with
+//     doubles are exact
+// Return Value: the number of primes less than or equal to N
+// In practice, has a small constant, and takes about a second for N = 10^13
+// Time Complexity: O(N^(3/4) / log N)
+// Memory Complexity: O(sqrt N)
+// Tested:
+//   Fuzz Tested
+template <class T> T primePi(T N) {
+  if (N < 3) return N < 2 ? 0 : 1;
+  int V = sqrtl(N) + 2; while ((long long)(V) * V > N) V--;
+  int S = (V + 1) / 2, pc = 0; vector<bool> skip(V + 1, false);
+  vector<int> small(S), rough(S); vector<long long> large(S);
+  auto quot = [&] (long long n, long long d) {
+    return (long long)(double(n) / d);
+  };
+  for (int i = 0; i < S; i++) {
+    small[i] = i; rough[i] = i * 2 + 1; large[i] = (N / rough[i] - 1) / 2;
+  }
+  for (int p = 3; p <= V; p += 2) if (!skip[p]) {
+    int q = p * p; if ((long long)(q) * q > N) break;
+    skip[p] = true; for (int i = q; i <= V; i += p * 2) skip[i] = true;
+    int ns = 0; for (int k = 0; k < S; k++) if (!skip[rough[k]]) {
+      long long d = (long long)(rough[k]) * p;
+      large[ns] = large[k] + pc - (d <= V ? large[small[d / 2] - pc]
+                                          : small[(quot(N, d) - 1) / 2]);
+      rough[ns++] = rough[k];
+    }
+    S = ns; for (int i = (V - 1) / 2, j = (V / p - 1) | 1; j >= p; j -= 2) {
+      int c = small[j / 2] - pc;
+      for (int e = j * p / 2; i >= e; i--) small[i] -= c;
+    }
+    pc++;
+  }
+  long long ret = large[0] + (long long)(S + (pc - 1) * 2) * (S - 1) / 2;
+  for (int k = 1; k < S; k++) ret -= large[k];
+  for (int l = 1; l < S; l++) {
+    long long q = rough[l], M = N / q;
+    int e = small[(M / q - 1) / 2] - pc; if (e <= l) break;
+    long long t = 0; for (int k = l + 1; k <= e; k++)
+      t += small[(quot(M, rough[k]) - 1) / 2];
+    ret += t - (long long)(e - l) * (pc + l - 1);
+  }
+  return ret + 1;
+}
+
 // Returns an arbitrary divisor of N
 // Template Arguments:
 //   T: the type of N
@@ -338,6 +538,127 @@ vector<pair<T, int>> pollardsRhoPrimeFactorWithCount(
   return ret;
 }
 
+// Determines whether a 64-bit integer x is prime with the Miller Rabin
+//   Primality Test over Montgomery multiplication, using the bases
+//   2, 325, 9375, 28178, 450775, 9780504, 1795265022 which are deterministic
+//   for all 64-bit integers
+// Function Arguments:
+//   x: the value to check if prime
+// Return Value: true if x is prime, false otherwise
+// In practice, has a small constant
+// Time Complexity: O(log x)
+// Memory Complexity: O(1)
+// Tested:
+//   Fuzz Tested
+bool millerRabin64(uint64_t x) {
+  if (x < 64) return (0x28208A20A08A28ACULL >> x) & 1;
+  if (x % 2 == 0 || x % 3 == 0 || x % 5 == 0 || x % 7 == 0) return false;
+  Montgomery64 M(x); int s = __builtin_ctzll(x - 1);
+  uint64_t d = (x - 1) >> s, neg = M.sub(0, M.one);
+  for (uint64_t a : {2U, 325U, 9375U, 28178U, 450775U, 9780504U,
+                     1795265022U}) {
+    uint64_t p = M.init(a); if (p == 0) continue;
+    p = M.pow(p, d); if (p == M.one || p == neg) continue;
+    int i = 1; for (; i < s && p != neg; i++) p = M.mul(p, p);
+    if (p != neg) return false;
+  }
+  return true;
+}
+
+// Returns a non trivial divisor of N using Pollard's rho algorithm with
+//   Brent's cycle detection over Montgomery multiplication, where the
+//   differences are multiplied together and a single gcd is computed per
+//   batch of BATCH steps, backtracking through the last batch if the gcd
+//   becomes N
+// Function Arguments:
+//   N: the value to find a divisor, must be composite
+// Return Value: a divisor of N in the range (1, N)
+// In practice, has a small constant
+// Time Complexity: O(N^(1/4)) expected
+// Memory Complexity: O(1)
+// Tested:
+//   Fuzz Tested
+uint64_t pollardsRhoBrent(uint64_t N) {
+  if (N % 2 == 0) return 2;
+  const int BATCH = 128; Montgomery64 M(N);
+  auto g = [&] (uint64_t a) {
+    if (a == 0) return N;
+    uint64_t b = N; int s = __builtin_ctzll(a); a >>= s;
+    while (b) { b >>= __builtin_ctzll(b); if (a > b) swap(a, b); b -= a; }
+    return a;
+  };
+  auto dist = [&] (uint64_t a, uint64_t b) { return a > b ? a - b : b - a; };
+  for (uint64_t c = M.one;; c = M.add(c, M.one)) {
+    auto f = [&] (uint64_t v) { return M.add(M.mul(v, v), c); };
+    uint64_t x = M.init(2), y = x, ys = x, q = M.one, d = 1;
+    for (int r = 1; d == 1; r <<= 1) {
+      x = y; for (int i = 0; i < r; i++) y = f(y);
+      for (int k = 0; k < r && d == 1; k += BATCH) {
+        ys = y; for (int i = 0; i < BATCH && i < r - k; i++) {
+          y = f(y); q = M.mul(q, dist(x, y));
+        }
+        d = g(q);
+      }
+    }
+    if (d == N) do { ys = f(ys); d = g(dist(x, ys)); } while (d == 1);
+    if (d != N) return d;
+  }
+}
+
+// Prime factors a 64-bit integer x with trial division by the primes less
+//   than 64, millerRabin64, and pollardsRhoBrent
+// Function Arguments:
+//   x: the value to prime factor
+// Return Value: a sorted vector of uint64_t with the prime factorization
+//   of x
+// In practice, has a small constant
+// Time Complexity: O(x^(1/4) log x) expected
+// Memory Complexity: O(log x)
+// Tested:
+//   Fuzz Tested
+vector<uint64_t> primeFactor64(uint64_t x) {
+  vector<uint64_t> ret, st; if (x == 0) return ret;
+  for (int s = __builtin_ctzll(x); s > 0; s--) ret.push_back(2);
+  x >>= __builtin_ctzll(x);
+  for (uint64_t p = 3; p < 64 && p * p <= x; p += 2)
+    while (x % p == 0) { ret.push_back(p); x /= p; }
+  if (x > 1) st.push_back(x);
+  while (!st.empty()) {
+    uint64_t y = st.back(); st.pop_back();
+    if (y < 67 * 67 || millerRabin64(y)) { ret.push_back(y); continue; }
+    uint64_t d = pollardsRhoBrent(y); st.push_back(d); st.push_back(y / d);
+  }
+  sort(ret.begin(), ret.end()); return ret;
+}
+
+// Prime factors each 64-bit integer in A with primeFactor64, using all cores
+//   with the numbers handed out to the threads in chunks on demand, as the
+//   time to factor each number varies widely
+// Function Arguments:
+//   A: a vector of uint64_t of the values to prime factor
+//   threads: the maximum number of threads to use
+// Return Value: a vector of vectors of uint64_t where the ith vector is the
+//   sorted prime factorization of A[i]
+// In practice, has a small constant
+// Time Complexity: O(sum(A[i]^(1/4) log A[i]) / threads) expected
+// Memory Complexity: O(size(A) log max(A))
+// Tested:
+//   Fuzz Tested
+vector<vector<uint64_t>> factorAll(
+    const vector<uint64_t> &A,
+    int threads = max(1, int(thread::hardware_concurrency()))) {
+  const int CHUNK = 256; int N = A.size(); vector<vector<uint64_t>> ret(N);
+  atomic<int> nxt(0); auto run = [&] {
+    for (int lo; (lo = nxt.fetch_add(CHUNK)) < N;)
+      for (int i = lo; i < min(N, lo + CHUNK); i++)
+        ret[i] = primeFactor64(A[i]);
+  };
+  vector<thread> ts; threads = min(threads, (N + CHUNK - 1) / CHUNK);
+  for (int t = 1; t < threads; t++) ts.emplace_back(run);
+  run(); for (auto &&t : ts) t.join();
+  return ret;
+}
+
 // Determines the factors of all numbers from 1 to N
 // Constructor Arguments:
 //   N: the maximum value
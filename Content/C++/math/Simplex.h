@@ -96,3 +96,301 @@ template <class F> struct Simplex {
     val = unbounded ? INF : T[M][N + 1];
   }
 };
+
+// Sparse Revised Simplex to solve a linear programming problem with N
+//   variables and M equations in canonical form with optional upper bounds:
+//     max c^T x
+//     subject to Ax <= b and 0 <= x <= ub
+//     where A is a sparse M x N matrix; b is a vector with dimension M;
+//     c, x, ub are vectors with dimension N
+// A slack variable is added for each equation, and only the basis is
+//   factorized with a sparse LU factorization using the Markowitz rule with
+//   threshold pivoting, with each basis change stored as an eta vector until
+//   the basis is refactorized after REFACTOR changes
+// The primal simplex uses the Dantzig rule with a Harris ratio test where
+//   the entering variable flips to its other bound if that is reached first,
+//   and the dual simplex uses the bound flipping ratio test, which passes
+//   over the breakpoints of boxed variables (flipping them) while the dual
+//   objective keeps improving
+// If the basis is neither primal nor dual feasible, phase one runs the dual
+//   simplex with random negative costs, which makes any basis dual feasible,
+//   until it is primal feasible, and phase two then runs the primal simplex
+// The basis is kept between calls to solve, so after changing c (which
+//   keeps it primal feasible), or b (which keeps it dual feasible), only a
+//   few pivots are usually needed
+// Template Arguments:
+//   F: a floating point type
+// Constructor Arguments:
+//   A: the sparse rows of the M x N coefficient matrix, with A[i] being a
+//     vector of pairs of column index and value
+//   b: a constraint vector, with dimension M
+//   c: a cost vector, with dimension N
+//   ub: the upper bounds of the variables, with dimension N, or empty if
+//     there are no upper bounds
+//   INF: a value for infinity
+//   EPS: a value for epsilon
+// Fields:
+//   M: the number of equations
+//   N: the number of variables
+//   INF: the value for infinity
+//   EPS: the value for epsilon
+//   b: the constraint vector, can be modified before calling solve
+//   c: the cost vector, can be modified before calling solve
+//   ub: the upper bounds, can be modified before calling solve
+//   val: the value of the maximum cost of the objective function c^T x,
+//     INF if unbounded, -INF if infeasible
+//   x: a solution vector of dimension N producing the maximum cost, can be
+//     any solution if unbounded, empty if infeasible
+//   basis: the variable in each position of the basis, where variable
+//     N + i is the slack of equation i
+//   iters: the number of pivots and bound flips in the last call to solve
+// Functions:
+//   solve(): solves the problem starting from the current basis, and sets
+//     val and x
+// In practice, has a moderate constant
+// Time Complexity:
+//   constructor, solve: O(2^N), worst case, each iteration takes
+//     O(N + M) plus the number of non zeros involved, much faster in
+//     practice
+// Memory Complexity: O(N + M + K + F) where K is the number of non zeros in
+//   A and F is the number of non zeros in the factorization
+// Tested:
+//   Fuzz Tested
+template <class F> struct RevisedSimplex {
+  static_assert(is_floating_point<F>::value,
+                "F must be a floating point type");
+  using Vec = vector<pair<int, F>>; static const int REFACTOR = 100;
+  int M, N; F INF, EPS, val; long long iters;
+  vector<Vec> rows, cols, L, U, Ucol, E;
+  vector<F> b, c, ub, x, xv, d, cost, diag, etaP, arow;
+  vector<int> basis, pos, pr, pc, etaR, touched; vector<char> mark;
+  F up(int j) const { return j < N ? ub[j] : INF; }
+  template <class G> void forCol(int j, G g) const {
+    if (j < N) for (auto &&e : cols[j]) g(e.first, e.second);
+    else g(j - N, F(1));
+  }
+  void factor() {
+    pr.clear(); pc.clear(); diag.clear(); L.clear(); U.clear(); E.clear();
+    etaR.clear(); etaP.clear(); vector<Vec> R(M); vector<vector<int>> C(M);
+    vector<int> cnt(M, 0), at(M, -1), bad; vector<char> done(M, 0);
+    for (int k = 0; k < M; k++) forCol(basis[k], [&] (int i, F v) {
+      R[i].emplace_back(k, v); C[k].push_back(i); cnt[k]++;
+    });
+    set<pair<int, int>> S; for (int k = 0; k < M; k++) S.emplace(cnt[k], k);
+    auto get = [&] (int i, int q) {
+      for (auto &&e : R[i]) if (e.first == q) return e.second;
+      return F();
+    };
+    while (!S.empty()) {
+      int q = S.begin()->second, p = -1; S.erase(S.begin()); F mx = F();
+      for (int i : C[q]) if (!done[i]) mx = max(mx, abs(get(i, q)));
+      for (int i : C[q]) if (!done[i] && mx > EPS && abs(get(i, q)) >= mx / 10
+                             && (p == -1 || R[i].size() < R[p].size())) p = i;
+      if (p == -1) { bad.push_back(q); continue; }
+      Vec u, l; F piv = F(); done[p] = 1; for (auto &&e : R[p]) {
+        if (e.first == q) piv = e.second;
+        else {
+          u.push_back(e); S.erase(make_pair(cnt[e.first], e.first));
+          cnt[e.first]--;
+        }
+      }
+      for (int i : C[q]) if (!done[i]) {
+        F m = F(); for (int k = 0; k < int(R[i].size()); k++)
+          if (R[i][k].first == q) {
+            m = R[i][k].second / piv; R[i][k] = R[i].back(); R[i].pop_back();
+            break;
+          }
+        if (m == F()) continue;
+        l.emplace_back(i, m);
+        for (int k = 0; k < int(R[i].size()); k++) at[R[i][k].first] = k;
+        for (auto &&e : u) {
+          if (at[e.first] >= 0) R[i][at[e.first]].second -= m * e.second;
+          else {
+            R[i].emplace_back(e.first, -m * e.second); C[e.first].push_back(i);
+            cnt[e.first]++;
+          }
+        }
+        for (auto &&e : R[i]) at[e.first] = -1;
+      }
+      for (auto &&e : u) S.emplace(cnt[e.first], e.first);
+      pr.push_back(p); pc.push_back(q); diag.push_back(piv);
+      L.push_back(move(l)); U.push_back(move(u)); Vec().swap(R[p]);
+    }
+    if (!bad.empty()) {
+      for (int i = 0, t = 0; i < M; i++) if (!done[i]) {
+        int j = basis[bad[t]]; pos[j] = -1; xv[j] = F();
+        basis[bad[t]] = N + i; pos[N + i] = bad[t++];
+      }
+      factor(); return;
+    }
+    Ucol.assign(M, Vec()); for (int k = 0; k < M; k++)
+      for (auto &&e : U[k]) Ucol[e.first].emplace_back(pr[k], e.second);
+  }
+  vector<F> ftran(vector<F> a) const {
+    for (int k = 0; k < M; k++) if (a[pr[k]] != F())
+      for (auto &&e : L[k]) a[e.first] -= e.second * a[pr[k]];
+    vector<F> y(M, F()); for (int k = M - 1; k >= 0; k--) {
+      F t = y[pc[k]] = a[pr[k]] / diag[k];
+      if (t != F()) for (auto &&e : Ucol[pc[k]]) a[e.first] -= e.second * t;
+    }
+    for (int e = 0; e < int(etaR.size()); e++) {
+      F t = y[etaR[e]] /= etaP[e];
+      if (t != F()) for (auto &&f : E[e]) y[f.first] -= f.second * t;
+    }
+    return y;
+  }
+  vector<F> btran(vector<F> y) const {
+    for (int e = int(etaR.size()) - 1; e >= 0; e--) {
+      F t = y[etaR[e]]; for (auto &&f : E[e]) t -= f.second * y[f.first];
+      y[etaR[e]] = t / etaP[e];
+    }
+    vector<F> z(M, F()); for (int k = 0; k < M; k++) {
+      F t = z[pr[k]] = y[pc[k]] / diag[k];
+      if (t != F()) for (auto &&e : U[k]) y[e.first] -= e.second * t;
+    }
+    for (int k = M - 1; k >= 0; k--)
+      for (auto &&e : L[k]) z[pr[k]] -= e.second * z[e.first];
+    return z;
+  }
+  vector<F> column(int j) const {
+    vector<F> a(M, F()); forCol(j, [&] (int i, F v) { a[i] += v; });
+    return ftran(a);
+  }
+  void recompute() {
+    vector<F> r = b, y(M); for (int j = 0; j < N + M; j++)
+      if (pos[j] < 0 && xv[j] != F())
+        forCol(j, [&] (int i, F v) { r[i] -= v * xv[j]; });
+    r = ftran(r); for (int k = 0; k < M; k++) {
+      xv[basis[k]] = r[k]; y[k] = cost[basis[k]];
+    }
+    y = btran(y); for (int j = 0; j < N + M; j++) {
+      d[j] = pos[j] >= 0 ? F() : cost[j];
+      if (pos[j] < 0) forCol(j, [&] (int i, F v) { d[j] -= y[i] * v; });
+    }
+  }
+  void pivotRow(int r) {
+    for (int j : touched) { arow[j] = F(); mark[j] = 0; }
+    touched.clear(); vector<F> e(M, F()); e[r] = F(1); e = btran(e);
+    auto add = [&] (int j, F v) {
+      if (!mark[j]) { mark[j] = 1; touched.push_back(j); }
+      arow[j] += v;
+    };
+    for (int i = 0; i < M; i++) if (e[i] != F()) {
+      add(N + i, e[i]); for (auto &&f : rows[i]) add(f.first, e[i] * f.second);
+    }
+  }
+  void update(int r, int q, const vector<F> &alpha) {
+    F t = d[q] / arow[q]; for (int j : touched) if (pos[j] < 0)
+      d[j] -= t * arow[j];
+    int lv = basis[r]; d[lv] = -t; d[q] = F(); pos[lv] = -1; pos[q] = r;
+    basis[r] = q; etaR.push_back(r); etaP.push_back(alpha[r]);
+    E.emplace_back();
+    for (int k = 0; k < M; k++) if (k != r && alpha[k] != F())
+      E.back().emplace_back(k, alpha[k]);
+    if (int(etaR.size()) >= REFACTOR) { factor(); recompute(); }
+  }
+  bool primal() {
+    const F PIV = F(1e-7); for (;; iters++) {
+      int q = -1; for (int j = 0; j < N + M; j++)
+        if (pos[j] < 0 && ((xv[j] < up(j) && d[j] > EPS)
+                           || (xv[j] > F() && d[j] < -EPS))
+            && (q == -1 || abs(d[j]) > abs(d[q]))) q = j;
+      if (q == -1) return true;
+      F dir = d[q] > F() ? F(1) : F(-1), tmax = up(q), tr = F();
+      vector<F> alpha = column(q); vector<int> nz; int r = -1;
+      for (int k = 0; k < M; k++) if (abs(alpha[k]) > PIV) nz.push_back(k);
+      auto ratio = [&] (int k, F tol) {
+        F a = -dir * alpha[k], v = xv[basis[k]], u = up(basis[k]);
+        return a < F() ? (v + tol) / -a : (u < INF ? (u - v + tol) / a : INF);
+      };
+      for (int k : nz) tmax = min(tmax, ratio(k, EPS));
+      if (tmax >= INF) return false;
+      for (int k : nz) {
+        F t = ratio(k, F()); if (t <= tmax
+            && (r == -1 || abs(alpha[k]) > abs(alpha[r]))) {
+          r = k; tr = max(t, F());
+        }
+      }
+      F theta = r == -1 || up(q) <= tr ? up(q) : tr;
+      for (int k = 0; k < M; k++) if (alpha[k] != F())
+        xv[basis[k]] -= dir * theta * alpha[k];
+      xv[q] += dir * theta; if (theta == up(q)) {
+        xv[q] = dir > F() ? up(q) : F(); continue;
+      }
+      int lv = basis[r]; xv[lv] = -dir * alpha[r] < F() ? F() : up(lv);
+      pivotRow(r); update(r, q, alpha);
+    }
+  }
+  bool dual() {
+    const F PIV = F(1e-7); for (;; iters++) {
+      int r = -1; F delta = EPS; for (int k = 0; k < M; k++) {
+        int j = basis[k]; F v = max(-xv[j], xv[j] - up(j));
+        if (v > delta) { delta = v; r = k; }
+      }
+      if (r == -1) return true;
+      int lv = basis[r], q = -1; bool below = xv[lv] < F();
+      pivotRow(r); vector<pair<F, int>> cand; for (int j : touched) {
+        F s = below ? -arow[j] : arow[j];
+        if (pos[j] >= 0 || abs(arow[j]) <= PIV || up(j) == F()) continue;
+        if ((xv[j] == F() && s > F()) || (xv[j] != F() && s < F()))
+          cand.emplace_back(max(abs(d[j]), F()) / abs(arow[j]), j);
+      }
+      sort(cand.begin(), cand.end(), [&] (const pair<F, int> &a,
+                                          const pair<F, int> &b) {
+        return a.first != b.first ? a.first < b.first
+                                  : abs(arow[a.second]) > abs(arow[b.second]);
+      });
+      vector<F> flip(M, F()); bool flipped = false; for (auto &&p : cand) {
+        int j = p.second; if (up(j) >= INF) { q = j; break; }
+        delta -= abs(arow[j]) * up(j); if (delta <= F()) { q = j; break; }
+        F t = xv[j] == F() ? up(j) : -up(j); xv[j] += t; flipped = true;
+        forCol(j, [&] (int i, F v) { flip[i] += v * t; }); iters++;
+      }
+      if (q == -1 && delta > EPS) return false;
+      if (flipped) {
+        flip = ftran(flip);
+        for (int k = 0; k < M; k++) xv[basis[k]] -= flip[k];
+      }
+      if (q == -1) continue;
+      vector<F> alpha = column(q); F target = below ? F() : up(lv);
+      F theta = (xv[lv] - target) / alpha[r];
+      for (int k = 0; k < M; k++) xv[basis[k]] -= theta * alpha[k];
+      xv[q] += theta; xv[lv] = target; update(r, q, alpha);
+    }
+  }
+  void solve() {
+    iters = 0; x.clear(); ub.resize(N, INF); for (int j = 0; j < N + M; j++) {
+      cost[j] = j < N ? c[j] : F();
+      if (pos[j] < 0) xv[j] = xv[j] == F() || up(j) >= INF ? F() : up(j);
+    }
+    factor(); recompute(); bool pf = true, df = true;
+    for (int k = 0; k < M; k++)
+      pf &= xv[basis[k]] >= -EPS && xv[basis[k]] <= up(basis[k]) + EPS;
+    for (int j = 0; j < N + M; j++) if (pos[j] < 0)
+      df &= (xv[j] >= up(j) || d[j] <= EPS) && (xv[j] == F() || d[j] >= -EPS);
+    if (!pf && !df) {
+      mt19937_64 rng(0); uniform_real_distribution<F> dist(F(1), F(2));
+      for (int j = 0; j < N + M; j++)
+        cost[j] = pos[j] >= 0 ? F() : (xv[j] == F() ? -dist(rng) : dist(rng));
+      recompute(); if (!dual()) { val = -INF; return; }
+      for (int j = 0; j < N + M; j++) cost[j] = j < N ? c[j] : F();
+      recompute();
+    } else if (!pf && !dual()) { val = -INF; return; }
+    bool bounded = primal(); factor(); recompute(); val = F();
+    x.assign(xv.begin(), xv.begin() + N);
+    for (int j = 0; j < N; j++) val += c[j] * x[j];
+    if (!bounded) val = INF;
+  }
+  RevisedSimplex(const vector<Vec> &A, const vector<F> &b, const vector<F> &c,
+                 const vector<F> &ub = vector<F>(),
+                 F INF = numeric_limits<F>::infinity(), F EPS = F(1e-9))
+      : M(b.size()), N(c.size()), INF(INF), EPS(EPS), rows(A), cols(N),
+        b(b), c(c), ub(ub), xv(N + M, F()), d(N + M, F()), cost(N + M, F()),
+        arow(N + M, F()), basis(M), pos(N + M, -1), mark(N + M, 0) {
+    for (int i = 0; i < M; i++) {
+      for (auto &&e : rows[i]) cols[e.first].emplace_back(i, e.second);
+      basis[i] = N + i; pos[N + i] = i;
+    }
+    solve();
+  }
+};
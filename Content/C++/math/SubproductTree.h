@@ -0,0 +1,128 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "FormalPowerSeries.h"
+#include "ModularArithmetic.h"
+#include "NTT.h"
+using namespace std;
+
+// Subproduct tree over a fixed set of points supporting multipoint
+//   evaluation and interpolation of polynomials modulo an NTT friendly prime
+// The polynomials of all nodes, and the inverses of their reversals used for
+//   the remainder computations, are stored in a single contiguous arena
+//   each, so the tree can be reused across many evaluations
+// Template Arguments:
+//   T: the type of the integer, must be integral
+//   MOD: the value to mod by, must be a prime less than 2^30 in the form
+//       C * 2^K + 1 for some integers C, K where 2N <= 2^K
+// Constructor Arguments:
+//   X: a vector of type T of the N points, must be in the range [0, MOD)
+// Fields:
+//   N: the number of points
+//   X: the points
+//   arena: the coefficients of the polynomial of each node, where node i
+//     covers the points with indices in the range [lo[i], hi[i]), and its
+//     polynomial prod (x - X[j]) is stored in the range
+//     [off[i], off[i] + hi[i] - lo[i]]
+//   invArena: the inverse of the reversal of the polynomial of each node
+//     modulo x^(hi[s] - lo[s]) where s is its sibling, stored starting at
+//     index ioff[i], for each node whose parent covers more than SMALL
+//     points
+// Functions:
+//   evaluate(P): returns a vector of the N values P(X[j]) where P is a
+//     polynomial with P[i] being the coefficient of x^i
+//   interpolate(Y): returns the polynomial of degree at most N - 1 with N
+//     coefficients passing through the points (X[j], Y[j]), the points in X
+//     must be distinct
+// In practice, has a moderate constant
+// Time Complexity:
+//   constructor, interpolate: O(N (log N)^2)
+//   evaluate: O(N (log N)^2 + M log M) where M = size(P)
+// Memory Complexity: O(N log N)
+// Tested:
+//   Fuzz Tested
+template <class T, const T MOD> struct SubproductTree {
+  using Poly = FPS<T, MOD>; using Workspace = typename Poly::Workspace;
+  static const int SMALL = 64;
+  int N, S; vector<T> X, arena, invArena; vector<int> lo, hi, off, ioff;
+  int cnt(int i) const { return hi[i] - lo[i]; }
+  vector<T> node(int i) const {
+    return vector<T>(arena.begin() + off[i], arena.begin() + off[i + 1]);
+  }
+  SubproductTree(const vector<T> &X) : N(X.size()), S(1), X(X) {
+    while (S < N) S <<= 1;
+    lo.assign(S * 2, 0); hi.assign(S * 2, 0); off.assign(S * 2 + 1, 0);
+    ioff.assign(S * 2 + 1, 0); for (int i = S; i < S * 2; i++) {
+      lo[i] = min(i - S, N); hi[i] = min(i - S + 1, N);
+    }
+    for (int i = S - 1; i >= 1; i--) {
+      lo[i] = lo[i * 2]; hi[i] = hi[i * 2 + 1];
+    }
+    for (int i = 1; i < S * 2; i++) {
+      off[i + 1] = off[i] + cnt(i) + 1;
+      ioff[i + 1] = ioff[i] + (i > 1 && cnt(i / 2) > SMALL ? cnt(i ^ 1) : 0);
+    }
+    arena.assign(off[S * 2], T()); invArena.assign(ioff[S * 2], T());
+    for (int i = S; i < S * 2; i++) {
+      arena[off[i]] = T(1); if (cnt(i) == 1) {
+        arena[off[i]] = X[i - S] == T() ? T() : MOD - X[i - S];
+        arena[off[i] + 1] = T(1);
+      }
+    }
+    Workspace w; for (int i = S - 1; i >= 1; i--) {
+      vector<T> p = mulPolyNTT<T, MOD>(node(i * 2), node(i * 2 + 1));
+      copy(p.begin(), p.end(), arena.begin() + off[i]);
+    }
+    for (int i = 2; i < S * 2; i++) if (ioff[i + 1] > ioff[i]) {
+      vector<T> rev = node(i); reverse(rev.begin(), rev.end());
+      vector<T> inv = Poly::invImpl(rev, ioff[i + 1] - ioff[i], w);
+      copy(inv.begin(), inv.end(), invArena.begin() + ioff[i]);
+    }
+  }
+  vector<T> remainder(const vector<T> &r, int i, Workspace &w) const {
+    int k = cnt(i) + 1, m = int(r.size()) - k + 1;
+    if (m <= 0) return r;
+    vector<T> ra(r.rbegin(), r.rbegin() + m), q = Poly::mulTrunc(
+        ra, vector<T>(invArena.begin() + ioff[i],
+                      invArena.begin() + ioff[i + 1]), m, w);
+    reverse(q.begin(), q.end());
+    vector<T> bq = Poly::mulTrunc(node(i), q, k - 1, w), res(k - 1, T());
+    for (int j = 0; j < k - 1; j++) res[j] = subMod(r[j], bq[j], MOD);
+    return res;
+  }
+  void evaluate(int i, const vector<T> &r, vector<T> &res,
+                Workspace &w) const {
+    if (cnt(i) <= SMALL) {
+      for (int j = lo[i]; j < hi[i]; j++) {
+        T v = T(); for (int k = int(r.size()) - 1; k >= 0; k--)
+          v = addMod(mulMod(v, X[j], MOD), r[k], MOD);
+        res[j] = v;
+      }
+      return;
+    }
+    for (int c = i * 2; c <= i * 2 + 1; c++)
+      if (cnt(c) > 0) evaluate(c, remainder(r, c, w), res, w);
+  }
+  vector<T> evaluate(const vector<T> &P) const {
+    vector<T> res(N, T()); if (N == 0) return res;
+    Poly p(P); while (!p.empty() && p.back() == T()) p.pop_back();
+    vector<T> r = p.divMod(Poly(node(1))).second;
+    Workspace w; evaluate(1, r, res, w); return res;
+  }
+  vector<T> interpolate(int i, const vector<T> &W) const {
+    if (cnt(i) <= 1) return vector<T>(W.begin() + lo[i], W.begin() + hi[i]);
+    vector<T> a = mulPolyNTT<T, MOD>(interpolate(i * 2, W), node(i * 2 + 1));
+    vector<T> b = mulPolyNTT<T, MOD>(interpolate(i * 2 + 1, W), node(i * 2));
+    vector<T> res(cnt(i), T()); for (int j = 0; j < cnt(i); j++)
+      res[j] = addMod(j < int(a.size()) ? a[j] : T(),
+                      j < int(b.size()) ? b[j] : T(), MOD);
+    return res;
+  }
+  vector<T> interpolate(const vector<T> &Y) const {
+    assert(int(Y.size()) == N); if (N == 0) return vector<T>();
+    vector<T> d(N, T()); for (int j = 0; j < N; j++)
+      d[j] = mulMod(arena[off[1] + j + 1], T(j + 1), MOD);
+    vector<T> W = evaluate(d); for (int j = 0; j < N; j++)
+      W[j] = mulMod(Y[j], mulInvModPrime(W[j], MOD), MOD);
+    return interpolate(1, W);
+  }
+};
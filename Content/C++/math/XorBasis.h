@@ -34,3 +34,118 @@ template <const int BITS> struct XorBasis {
     return v.none();
   }
 };
+
+// Maintains the basis of vectors in base 2 of every prefix of an array,
+//   where the basis of each prefix keeps the vector with the latest possible
+//   position for each most significant bit, so the vectors of the basis of
+//   the prefix ending at r with positions at least l form a basis of the
+//   subarray [l, r]
+// Indices are 0-indexed and ranges are inclusive
+// Template Arguments:
+//   T: the type of each vector, must be an unsigned integral type
+//   BITS: the number of bits of each vector
+// Constructor Arguments:
+//   A: a vector of type T of the initial array
+// Fields:
+//   N: the size of the array
+//   basis: a vector of length (N + 1) * BITS, where basis[r * BITS + i] is
+//     the vector of the basis of the first r elements with the most
+//     significant bit of i, or 0 if there is no such vector
+//   pos: a vector of length (N + 1) * BITS, where pos[r * BITS + i] is the
+//     index of the element that basis[r * BITS + i] was created from, or -1
+//     if there is no such vector
+// Functions:
+//   push_back(v): adds v to the end of the array
+//   rangeBasis(l, r): returns a basis of the subarray [l, r]
+//   rangeMaxXor(l, r, x): returns the maximum value of x xor the xor of any
+//     subset of the subarray [l, r]
+//   inSpan(l, r, v): returns whether v is the xor of a subset of the
+//     subarray [l, r]
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(N BITS)
+//   push_back, rangeBasis, rangeMaxXor, inSpan: O(BITS)
+// Memory Complexity: O(N BITS)
+// Tested:
+//   Fuzz Tested
+template <class T, const int BITS = 8 * sizeof(T)> struct PrefixXorBasis {
+  static_assert(is_unsigned<T>::value, "T must be an unsigned integral type");
+  int N; vector<T> basis; vector<int> pos;
+  static void insert(T *b, int *q, T v, int p) {
+    for (int i = BITS - 1; i >= 0; i--) if (v >> i & 1) {
+      if (q[i] == -1) { b[i] = v; q[i] = p; return; }
+      if (q[i] < p) { swap(b[i], v); swap(q[i], p); }
+      v ^= b[i];
+    }
+  }
+  PrefixXorBasis(const vector<T> &A = vector<T>())
+      : N(0), basis(BITS, T()), pos(BITS, -1) {
+    basis.reserve((A.size() + 1) * BITS); pos.reserve((A.size() + 1) * BITS);
+    for (auto &&a : A) push_back(a);
+  }
+  void push_back(T v) {
+    basis.resize(basis.size() + BITS); pos.resize(pos.size() + BITS);
+    copy_n(basis.end() - BITS * 2, BITS, basis.end() - BITS);
+    copy_n(pos.end() - BITS * 2, BITS, pos.end() - BITS);
+    insert(basis.data() + (N + 1) * BITS, pos.data() + (N + 1) * BITS, v, N);
+    N++;
+  }
+  vector<T> rangeBasis(int l, int r) const {
+    vector<T> ret; const T *b = basis.data() + (r + 1) * BITS;
+    const int *q = pos.data() + (r + 1) * BITS;
+    for (int i = BITS - 1; i >= 0; i--) if (q[i] >= l) ret.push_back(b[i]);
+    return ret;
+  }
+  T rangeMaxXor(int l, int r, T x = T()) const {
+    const T *b = basis.data() + (r + 1) * BITS;
+    const int *q = pos.data() + (r + 1) * BITS;
+    for (int i = BITS - 1; i >= 0; i--)
+      if (q[i] >= l && !(x >> i & 1)) x ^= b[i];
+    return x;
+  }
+  bool inSpan(int l, int r, T v) const {
+    const T *b = basis.data() + (r + 1) * BITS;
+    const int *q = pos.data() + (r + 1) * BITS;
+    for (int i = BITS - 1; i >= 0; i--) if (v >> i & 1) {
+      if (q[i] < l) return false;
+      v ^= b[i];
+    }
+    return true;
+  }
+};
+
+// Answers offline queries of the maximum xor of any subset of a subarray by
+//   sweeping over the right endpoints with a single basis that keeps the
+//   vector with the latest possible position for each most significant bit
+// Indices are 0-indexed and ranges are inclusive
+// Template Arguments:
+//   T: the type of each vector, must be an unsigned integral type
+//   BITS: the number of bits of each vector
+// Function Arguments:
+//   A: a vector of type T of the array
+//   queries: a vector of pairs (l, r) of the subarrays to query
+// Return Value: a vector of type T with the maximum xor of any subset of the
+//   subarray for each query
+// In practice, has a small constant
+// Time Complexity: O((N + Q) BITS + Q log Q) for Q queries
+// Memory Complexity: O(BITS + Q)
+// Tested:
+//   Fuzz Tested
+template <class T, const int BITS = 8 * sizeof(T)>
+vector<T> rangeMaxXorOffline(const vector<T> &A,
+                             const vector<pair<int, int>> &queries) {
+  int Q = queries.size(); vector<int> ord(Q); vector<T> ret(Q, T());
+  iota(ord.begin(), ord.end(), 0);
+  sort(ord.begin(), ord.end(), [&] (int i, int j) {
+    return queries[i].second < queries[j].second;
+  });
+  T b[BITS]; int q[BITS]; fill(b, b + BITS, T()); fill(q, q + BITS, -1);
+  for (int k = 0, r = 0; k < Q; k++) {
+    int l = queries[ord[k]].first, qr = queries[ord[k]].second; T x = T();
+    for (; r <= qr; r++) PrefixXorBasis<T, BITS>::insert(b, q, A[r], r);
+    for (int i = BITS - 1; i >= 0; i--)
+      if (q[i] >= l && !(x >> i & 1)) x ^= b[i];
+    ret[ord[k]] = x;
+  }
+  return ret;
+}
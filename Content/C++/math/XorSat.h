@@ -51,3 +51,126 @@ template <const int MAXN> struct XorSat {
     for (int i = 0; i < N; i++) if (ind[i] == -1) solutions = INF_SOLUTIONS;
   }
 };
+
+// Helper function for PackedXorSat that xors the words of the 8 rows t[k]
+//   into x for each index in the range [0, len), where the arrays do not
+//   overlap
+void xorRowsPacked(uint64_t *__restrict__ x, const uint64_t *const *t,
+                   int len) {
+  const uint64_t *__restrict__ t0 = t[0], *__restrict__ t1 = t[1];
+  const uint64_t *__restrict__ t2 = t[2], *__restrict__ t3 = t[3];
+  const uint64_t *__restrict__ t4 = t[4], *__restrict__ t5 = t[5];
+  const uint64_t *__restrict__ t6 = t[6], *__restrict__ t7 = t[7];
+  for (int j = 0; j < len; j++)
+    x[j] ^= t0[j] ^ t1[j] ^ t2[j] ^ t3[j] ^ t4[j] ^ t5[j] ^ t6[j] ^ t7[j];
+}
+
+// Solve the xor boolean satisfiability problem for a boolean matrix A of
+//   size M x N, and vectors b of size M, and vector x of size N, so that
+//   b_i = xor(A[i][j] & x[j]) for 0 <= j < N, with a runtime number of
+//   variables, and also computes the rank and a basis of the nullspace
+// The rows are packed into 64 bit words in a single flat array, and the row
+//   echelon form is computed with the Method of Four Russians, where the
+//   pivots in the columns of a single word are found by only updating that
+//   word of each row, the pivot rows are reduced against each other, and
+//   each row below is then updated once by looking up the combinations of
+//   the pivot rows selected by its bits in the pivot columns in 8 tables of
+//   256 rows each, after which each vector is found by back substitution
+// Constructor Arguments:
+//   M: the number of equations
+//   N: the number of variables
+//   A: a vector of M * ((N + 63) / 64) words, where A[i][j] is bit j % 64
+//     of the word A[i * ((N + 63) / 64) + j / 64]
+//   b: a boolean vector, with dimension M
+// Fields:
+//   NO_SOLUTION: static const int representing no solution
+//   ONE_SOLUTION: static const int representing one solution
+//   INF_SOLUTIONS: static const int representing infinite solution
+//   M: the number of equations
+//   N: the number of variables
+//   W: the number of words in each packed row, including the column for b
+//   rank: the rank of the matrix A
+//   solutions: the number of solution to the equation, equal to one of
+//     NO_SOLUTION, ONE_SOLUTION, or INF_SOLUTIONS
+//   x: the solution vector with dimension N packed into (N + 63) / 64 words,
+//     can be any solution if there are infinite solutions, empty if no
+//     solutions
+//   nullspace: a basis of the vectors y with Ay = 0, each packed into
+//     (N + 63) / 64 words
+// In practice, has a small constant, and solves a random 20000 x 20000
+//   system in about 5 seconds
+// Time Complexity:
+//   constructor: O(min(M, N) MN / 512 + (N - rank + 1) rank N / 64)
+// Memory Complexity: O(MN / 64 + N (N - rank) / 64)
+// Tested:
+//   Stress Tested
+struct PackedXorSat {
+  static const int NO_SOLUTION = 0, ONE_SOLUTION = 1, INF_SOLUTIONS = 2;
+  int M, N, W, rank, solutions; vector<uint64_t> x;
+  vector<vector<uint64_t>> nullspace;
+  PackedXorSat(int M, int N, const vector<uint64_t> &A, const vector<bool> &b)
+      : M(M), N(N), W(N / 64 + 1), rank(0), solutions(ONE_SOLUTION) {
+    int IW = (N + 63) / 64; vector<uint64_t> a(size_t(M) * W, 0), cur(M);
+    for (int i = 0; i < M; i++) {
+      copy_n(A.begin() + size_t(i) * IW, IW, a.begin() + size_t(i) * W);
+      if (b[i]) a[size_t(i) * W + N / 64] |= uint64_t(1) << (N % 64);
+    }
+    auto row = [&] (int i) { return a.data() + size_t(i) * W; };
+    vector<uint64_t> F(64 * W), T(256 * 8 * W, 0); vector<int> piv, cols;
+    for (int c = 0, r = 0; c < N && r < M; r += cols.size()) {
+      int w = c / 64, end = min(N, w * 64 + 64); cols.clear();
+      for (int i = r; i < M; i++) cur[i] = row(i)[w];
+      for (; c < end && r + int(cols.size()) < M; c++) {
+        int q = r + cols.size(), p = q, cnt = cols.size();
+        while (p < M && !(cur[p] >> (c % 64) & 1)) p++;
+        if (p == M) continue;
+        swap_ranges(row(p), row(p) + W, row(q)); swap(cur[p], cur[q]);
+        uint64_t *f = F.data() + cnt * W; copy(row(q) + w, row(q) + W, f + w);
+        for (int t = 0; t < cnt; t++) if (row(q)[w] >> (cols[t] % 64) & 1)
+          for (int j = w; j < W; j++) f[j] ^= F[t * W + j];
+        for (int t = 0; t < cnt; t++) if (F[t * W + w] >> (c % 64) & 1)
+          for (int j = w; j < W; j++) F[t * W + j] ^= f[j];
+        for (int i = q + 1; i < M; i++) if (cur[i] >> (c % 64) & 1)
+          cur[i] ^= f[w];
+        cols.push_back(c);
+      }
+      int cnt = cols.size(); if (cnt == 0) continue;
+      for (int g = 0; g * 8 < cnt; g++) {
+        uint64_t *tb = T.data() + g * 256 * W;
+        for (int s = 1; s < (1 << min(8, cnt - g * 8)); s++) {
+          uint64_t *u = tb + s * W, *v = tb + (s & (s - 1)) * W;
+          uint64_t *f = F.data() + (g * 8 + __builtin_ctz(s)) * W;
+          for (int j = w; j < W; j++) u[j] = v[j] ^ f[j];
+        }
+      }
+      for (int i = r + cnt; i < M; i++) {
+        uint64_t o = row(i)[w]; int id[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        for (int t = 0; t < cnt; t++)
+          id[t / 8] |= int(o >> (cols[t] % 64) & 1) << (t % 8);
+        const uint64_t *tp[8]; for (int g = 0; g < 8; g++)
+          tp[g] = T.data() + (g * 256 + id[g]) * W + w;
+        xorRowsPacked(row(i) + w, tp, W - w);
+      }
+      for (int t = 0; t < cnt; t++)
+        copy(F.begin() + t * W + w, F.begin() + t * W + W, row(r + t) + w);
+      piv.insert(piv.end(), cols.begin(), cols.end());
+    }
+    rank = piv.size(); vector<bool> isPiv(N, false);
+    for (int t = 0; t < rank; t++) isPiv[piv[t]] = true;
+    auto back = [&] (vector<uint64_t> &y, bool useB) {
+      for (int t = rank - 1; t >= 0; t--) {
+        const uint64_t *z = row(t); int w = piv[t] / 64; uint64_t s = 0;
+        for (int j = w; j < IW; j++) s ^= z[j] & y[j];
+        s = __builtin_parityll(s) ^ (useB ? z[N / 64] >> (N % 64) & 1 : 0);
+        y[w] |= s << (piv[t] % 64);
+      }
+    };
+    for (int f = 0; f < N; f++) if (!isPiv[f]) {
+      vector<uint64_t> y(IW, 0); y[f / 64] |= uint64_t(1) << (f % 64);
+      back(y, false); nullspace.push_back(move(y));
+    }
+    for (int i = rank; i < M; i++)
+      if (row(i)[N / 64] >> (N % 64) & 1) { solutions = NO_SOLUTION; return; }
+    x.assign(IW, 0); back(x, true); if (rank < N) solutions = INF_SOLUTIONS;
+  }
+};
@@ -0,0 +1,81 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/datastructures/BlockSparseTable.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e5;
+  long long checkSum = 0;
+  struct Min { int operator () (int a, int b) { return min(a, b); } };
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 101;
+    vector<int> A(N);
+    for (auto &&a : A) a = rng() % int(1e9) + 1;
+    BlockSparseTable<int, Min> ST(A);
+    int Q = N == 0 ? 0 : 100 - rng() % 5;
+    vector<int> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      int mn = A[l];
+      for (int j = l + 1; j <= r; j++) mn = min(mn, A[j]);
+      ans0.push_back(mn);
+      ans1.push_back(ST.query(l, r));
+    }
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = 31 * checkSum + a;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (minimum) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  struct Gcd { long long operator () (long long a, long long b) { return __gcd(a, b); } };
+  struct Or { long long operator () (long long a, long long b) { return a | b; } };
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 301;
+    vector<long long> A(N), G(N);
+    for (int i = 0; i < N; i++) {
+      A[i] = rng() % (1 << 10);
+      G[i] = (rng() % 30 + 1) * (rng() % 3 == 0 ? 1 : 64);
+    }
+    BlockSparseTable<long long, Or, 4> ST0(A);
+    BlockSparseTable<long long, Gcd> ST1(G);
+    BlockSparseTable<long long, Or, 1> ST2(A);
+    int Q = N == 0 ? 0 : 100;
+    for (int i = 0; i < Q; i++) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      long long o = 0, g = 0;
+      for (int j = l; j <= r; j++) {
+        o |= A[j];
+        g = __gcd(g, G[j]);
+      }
+      assert(ST0.query(l, r) == o);
+      assert(ST1.query(l, r) == g);
+      assert(ST2.query(l, r) == o);
+      checkSum = 31 * checkSum + o;
+      checkSum = 31 * checkSum + g;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (bitwise or and gcd, various block sizes) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/DynamicSegmentTree.h"
+using namespace std;
+
+struct C1 {
+  using Data = long long;
+  using Lazy = long long;
+  static Data qdef() { return 0; }
+  static Data merge(const Data &l, const Data &r) { return l + r; }
+  static Data applyLazy(const Data &l, const Lazy &r) { return l + r; }
+  template <class IndexType> static Data getSegmentVdef(IndexType k) { return k; }
+};
+
+struct C2 {
+  using Data = long long;
+  using Lazy = long long;
+  static Data qdef() { return 0; }
+  static Lazy ldef() { return 0; }
+  static Data merge(const Data &l, const Data &r) { return l + r; }
+  template <class IndexType> static Data applyLazy(const Data &l, const Lazy &r, IndexType k) { return l + r * k; }
+  static Lazy mergeLazy(const Lazy &l, const Lazy &r) { return l + r; }
+  template <class IndexType> static Data getSegmentVdef(IndexType k) { return k; }
+};
+
+template <class ST> void rangeUpdate(ST &st, int l, int r, long long v, bool newRoot, true_type) { st.update(l, r, v, newRoot); }
+
+template <class ST> void rangeUpdate(ST &st, int l, int, long long v, bool newRoot, false_type) { st.update(l, v, newRoot); }
+
+template <const bool LAZY, class C> void test(int subtest, const string &name) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(subtest);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 50 + 1;
+    DynamicSegmentTree<int, LAZY, true, C> ST(N);
+    vector<vector<long long>> A(1, vector<long long>(N, 1));
+    vector<bool> alive(1, true);
+    for (int i = 0; i < 200; i++) {
+      int t = rng() % 10, V = A.size();
+      if (t < 4) {
+        int l = rng() % N, r = LAZY ? rng() % N : l;
+        if (l > r) swap(l, r);
+        long long v = rng() % 10;
+        bool newRoot = rng() % 2 == 0;
+        rangeUpdate(ST, l, r, v, newRoot, integral_constant<bool, LAZY>());
+        if (newRoot) {
+          A.push_back(A.back());
+          alive.push_back(true);
+        }
+        for (int j = l; j <= r; j++) A.back()[j] += v;
+      } else if (t < 7) {
+        int k = rng() % V;
+        if (!alive[k]) continue;
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        long long q = ST.query(l, r, k);
+        assert(q == accumulate(A[k].begin() + l, A[k].begin() + r + 1, 0LL));
+        checkSum = 31 * checkSum + q;
+      } else if (t == 7) {
+        int k = rng() % V;
+        if (!alive[k]) continue;
+        ST.revert(k);
+        A.push_back(A[k]);
+        alive.push_back(true);
+      } else if (t == 8) {
+        int k = rng() % V;
+        if (k == V - 1 || !alive[k]) continue;
+        int retained = ST.retainedNodes(k), before = ST.nodeCount();
+        assert(retained <= ST.versionNodes(k));
+        ST.release(k);
+        alive[k] = false;
+        ST.collect();
+        assert(ST.nodeCount() <= before - retained);
+      } else {
+        int before = ST.nodeCount();
+        ST.collect();
+        int reachable = 0;
+        for (int k = 0; k < V; k++) if (alive[k]) reachable = max(reachable, ST.versionNodes(k));
+        assert(ST.nodeCount() <= before && ST.nodeCount() >= reachable);
+        checkSum = 31 * checkSum + ST.nodeCount();
+      }
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(3);
+  const int N = 1e5, U = 1e6, LIVE = 100, COLLECT = 10000;
+  DynamicSegmentTree<int, true, true, C2> ST(N);
+  deque<int> live(1, 0);
+  int maxNodes = 0;
+  long long allocated = ST.nodeCount();
+  size_t maxMemory = 0;
+  const void *first = nullptr;
+  long long checkSum = 0;
+  for (int i = 0; i < U; i++) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    ST.update(l, r, rng() % 10, true);
+    if (!first) first = &ST.TR[0];
+    live.push_back(ST.roots.size() - 1);
+    if (int(live.size()) > LIVE) {
+      ST.release(live.front());
+      live.pop_front();
+    }
+    if (i % COLLECT == COLLECT - 1) {
+      allocated += ST.nodeCount();
+      ST.collect();
+      allocated -= ST.nodeCount();
+      maxNodes = max(maxNodes, ST.nodeCount());
+      maxMemory = max(maxMemory, ST.memoryUsage());
+      assert(&ST.TR[0] == first);
+      checkSum = 31 * checkSum + ST.query(0, N - 1);
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (long running versions with release and collect) Passed" << endl;
+  cout << "  U: " << U << ", live versions: " << LIVE << endl;
+  cout << "  Nodes allocated: " << allocated + ST.nodeCount() << endl;
+  cout << "  Max nodes after collect: " << maxNodes << endl;
+  cout << "  Max memory after collect: " << maxMemory / (1 << 20) << "MB" << endl;
+  cout << "  Nodes retained by the latest version: " << ST.retainedNodes(live.back()) << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<false, C1>(1, "persistent point updates");
+  test<true, C2>(2, "persistent range updates");
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
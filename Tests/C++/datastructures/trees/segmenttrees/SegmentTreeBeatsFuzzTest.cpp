@@ -0,0 +1,69 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeBeats.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 2000, Q = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 40 + 1, V = rng() % 2 == 0 ? 5 : 1000;
+    vector<long long> A(N), B(N, 0), HX(N), HN(N);
+    for (auto &&a : A) a = int(rng() % (2 * V + 1)) - V;
+    HX = HN = A;
+    SegmentTreeBeatsHistoric<long long> ST(A);
+    for (int q = 0; q < Q; q++) {
+      int t = rng() % 9, l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      long long v = int(rng() % (2 * V + 1)) - V;
+      if (t <= 2) {
+        if (t == 0) {
+          v /= 2;
+          ST.add(l, r, v);
+          for (int i = l; i <= r; i++) A[i] += v;
+        } else if (t == 1) {
+          ST.chmin(l, r, v);
+          for (int i = l; i <= r; i++) A[i] = min(A[i], v);
+        } else {
+          ST.chmax(l, r, v);
+          for (int i = l; i <= r; i++) A[i] = max(A[i], v);
+        }
+        for (int i = 0; i < N; i++) {
+          B[i] += A[i];
+          HX[i] = max(HX[i], A[i]);
+          HN[i] = min(HN[i], A[i]);
+        }
+      } else {
+        long long sm = 0, mx = LLONG_MIN, mn = LLONG_MAX, hs = 0, hx = LLONG_MIN, hn = LLONG_MAX;
+        for (int i = l; i <= r; i++) {
+          sm += A[i];
+          mx = max(mx, A[i]);
+          mn = min(mn, A[i]);
+          hs += B[i];
+          hx = max(hx, HX[i]);
+          hn = min(hn, HN[i]);
+        }
+        long long ans;
+        if (t == 3) assert((ans = ST.querySum(l, r)) == sm);
+        else if (t == 4) assert((ans = ST.queryMax(l, r)) == mx);
+        else if (t == 5) assert((ans = ST.queryMin(l, r)) == mn);
+        else if (t == 6) assert((ans = ST.queryHistoricSum(l, r)) == hs);
+        else if (t == 7) assert((ans = ST.queryHistoricMax(l, r)) == hx);
+        else assert((ans = ST.queryHistoricMin(l, r)) == hn);
+        checkSum = 31 * checkSum + ans;
+      }
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (historic queries against brute force) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  cout << "Test Passed" << endl;
+  return 0;
+}
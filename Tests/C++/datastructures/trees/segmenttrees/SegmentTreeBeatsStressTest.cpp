@@ -0,0 +1,139 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeBeats.h"
+using namespace std;
+
+struct C {
+  static const long long INF = LLONG_MAX / 4;
+  struct Data { long long sm, mx1, mx2, mn1, mn2; int mxcnt, mncnt; };
+  struct Lazy {
+    long long mn, mx, inc;
+    bool operator != (const Lazy &l) const { return mn != l.mn || mx != l.mx || inc != l.inc; }
+  };
+  struct Arg { int t; long long v; };
+  static Data qdef() { return Data{0, -INF, -INF, INF, INF, 0, 0}; }
+  static Lazy ldef() { return Lazy{INF, -INF, 0}; }
+  static Lazy makeLazy(const Data &, const Arg &a) {
+    if (a.t == 0) return Lazy{a.v, -INF, 0};
+    if (a.t == 1) return Lazy{INF, a.v, 0};
+    return Lazy{INF, -INF, a.v};
+  }
+  static bool breakCond(const Data &d, const Arg &a) {
+    return (a.t == 0 && d.mx1 <= a.v) || (a.t == 1 && d.mn1 >= a.v);
+  }
+  static bool tagCond(const Data &d, const Arg &a) {
+    return (a.t == 0 && d.mx2 < a.v) || (a.t == 1 && d.mn2 > a.v) || a.t == 2;
+  }
+  static Data merge(const Data &l, const Data &r) {
+    Data ret;
+    ret.sm = l.sm + r.sm;
+    if (l.mx1 == r.mx1) { ret.mx1 = l.mx1; ret.mxcnt = l.mxcnt + r.mxcnt; ret.mx2 = max(l.mx2, r.mx2); }
+    else if (l.mx1 > r.mx1) { ret.mx1 = l.mx1; ret.mxcnt = l.mxcnt; ret.mx2 = max(l.mx2, r.mx1); }
+    else { ret.mx1 = r.mx1; ret.mxcnt = r.mxcnt; ret.mx2 = max(l.mx1, r.mx2); }
+    if (l.mn1 == r.mn1) { ret.mn1 = l.mn1; ret.mncnt = l.mncnt + r.mncnt; ret.mn2 = min(l.mn2, r.mn2); }
+    else if (l.mn1 < r.mn1) { ret.mn1 = l.mn1; ret.mncnt = l.mncnt; ret.mn2 = min(l.mn2, r.mn1); }
+    else { ret.mn1 = r.mn1; ret.mncnt = r.mncnt; ret.mn2 = min(l.mn1, r.mn2); }
+    return ret;
+  }
+  static Data applyLazy(const Data &l, const Lazy &r, int k) {
+    Data ret = l;
+    if (r.inc != 0) {
+      ret.sm += r.inc * k;
+      ret.mx1 += r.inc; if (ret.mx2 != -INF) ret.mx2 += r.inc;
+      ret.mn1 += r.inc; if (ret.mn2 != INF) ret.mn2 += r.inc;
+    }
+    if (r.mn < ret.mx1) {
+      ret.sm -= (ret.mx1 - r.mn) * ret.mxcnt;
+      if (ret.mn1 == ret.mx1) ret.mn1 = r.mn;
+      else if (ret.mn2 == ret.mx1) ret.mn2 = r.mn;
+      ret.mx1 = r.mn;
+    }
+    if (r.mx > ret.mn1) {
+      ret.sm += (r.mx - ret.mn1) * ret.mncnt;
+      if (ret.mx1 == ret.mn1) ret.mx1 = r.mx;
+      else if (ret.mx2 == ret.mn1) ret.mx2 = r.mx;
+      ret.mn1 = r.mx;
+    }
+    return ret;
+  }
+  static Lazy mergeLazy(const Lazy &l, const Lazy &r) {
+    Lazy ret;
+    ret.inc = l.inc + r.inc;
+    ret.mn = l.mn == INF ? INF : l.mn + r.inc;
+    ret.mx = l.mx == -INF ? -INF : l.mx + r.inc;
+    ret.mx = max(min(ret.mx, r.mn), r.mx);
+    ret.mn = min(ret.mn, r.mn);
+    return ret;
+  }
+};
+
+struct Op { int t, l, r; long long v; };
+
+vector<Op> ops(mt19937_64 &rng, int N, int Q, int V) {
+  vector<Op> ret;
+  for (int i = 0; i < Q; i++) {
+    int t = rng() % 6, l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    long long v = int(rng() % (2 * V + 1)) - V;
+    ret.push_back(Op{t, l, r, t == 2 ? v / 8 : v});
+  }
+  return ret;
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  const int N = 1e6, Q = 1e6, V = 100;
+  vector<long long> A(N);
+  for (auto &&a : A) a = int(rng() % (2 * V + 1)) - V;
+  vector<Op> O = ops(rng, N, Q, V);
+  vector<C::Data> D(N);
+  for (int i = 0; i < N; i++) D[i] = C::Data{A[i], A[i], -C::INF, A[i], C::INF, 1, 1};
+  const auto start_time = chrono::system_clock::now();
+  SegmentTreeBeats<C> ST(D);
+  long long checkSum = 0, historicSum = 0;
+  for (auto &&o : O) {
+    if (o.t < 3) ST.update(o.l, o.r, C::Arg{o.t, o.v});
+    else if (o.t == 3) checkSum = 31 * checkSum + ST.query(o.l, o.r).sm;
+    else if (o.t == 4) historicSum = 31 * historicSum + ST.query(o.l, o.r).mx1 - ST.query(o.l, o.r).mn1;
+    else historicSum = 31 * historicSum + ST.query(o.l, o.r).sm;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (generic array of nodes, no historic tags) Passed" << endl;
+  cout << "  N: " << N << ", Q: " << Q << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+  cout << "  Non Historic Checksum: " << historicSum << endl;
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  const int N = 1e6, Q = 1e6, V = 100;
+  vector<long long> A(N);
+  for (auto &&a : A) a = int(rng() % (2 * V + 1)) - V;
+  vector<Op> O = ops(rng, N, Q, V);
+  const auto start_time = chrono::system_clock::now();
+  SegmentTreeBeatsHistoric<long long> ST(A);
+  long long checkSum = 0, historicSum = 0;
+  for (auto &&o : O) {
+    if (o.t == 0) ST.chmin(o.l, o.r, o.v);
+    else if (o.t == 1) ST.chmax(o.l, o.r, o.v);
+    else if (o.t == 2) ST.add(o.l, o.r, o.v);
+    else if (o.t == 3) checkSum = 31 * checkSum + ST.querySum(o.l, o.r);
+    else if (o.t == 4) historicSum = 31 * historicSum + ST.queryHistoricMax(o.l, o.r) - ST.queryHistoricMin(o.l, o.r);
+    else historicSum = 31 * historicSum + ST.queryHistoricSum(o.l, o.r);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (split node arrays, with historic tags) Passed" << endl;
+  cout << "  N: " << N << ", Q: " << Q << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+  cout << "  Historic Checksum: " << historicSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
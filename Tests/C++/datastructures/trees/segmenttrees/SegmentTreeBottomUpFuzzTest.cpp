@@ -0,0 +1,253 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeBottomUp.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeLazyBottomUp.h"
+using namespace std;
+
+struct C1 {
+  using Data = long long;
+  using Lazy = long long;
+  static Data qdef() { return 0; }
+  static Data merge(const Data &l, const Data &r) { return l + r; }
+  static Data applyLazy(const Data &l, const Lazy &r) { return l + r; }
+};
+
+struct C2 {
+  using Data = pair<long long, int>;
+  using Lazy = long long;
+  static Data qdef() { return make_pair(0LL, 0); }
+  static Lazy ldef() { return 0; }
+  static Data merge(const Data &l, const Data &r) { return make_pair(l.first + r.first, l.second + r.second); }
+  static Data applyLazy(const Data &l, const Lazy &r, int k) { return make_pair(l.first + r * k, l.second); }
+  static Lazy mergeLazy(const Lazy &l, const Lazy &r) { return l + r; }
+};
+
+// string concatenation, which is not commutative
+struct C3 {
+  using Data = string;
+  using Lazy = string;
+  static Data qdef() { return ""; }
+  static Data merge(const Data &l, const Data &r) { return l + r; }
+  static Data applyLazy(const Data &, const Lazy &r) { return r; }
+};
+
+// range affine updates and range sum queries, where the lazy values do not commute
+struct C4 {
+  using Data = long long;
+  using Lazy = pair<long long, long long>;
+  static const long long MOD = 998244353;
+  static Data qdef() { return 0; }
+  static Lazy ldef() { return make_pair(1LL, 0LL); }
+  static Data merge(const Data &l, const Data &r) { return (l + r) % MOD; }
+  static Data applyLazy(const Data &l, const Lazy &r, int k) { return (r.first * l + r.second * k) % MOD; }
+  static Lazy mergeLazy(const Lazy &l, const Lazy &r) { return make_pair(l.first * r.first % MOD, (l.second * r.first + r.second) % MOD); }
+};
+
+int bruteMaxRight(const vector<long long> &A, int l, long long X) {
+  long long sm = 0;
+  int r = l - 1;
+  while (r + 1 < int(A.size()) && sm + A[r + 1] <= X) sm += A[++r];
+  return r;
+}
+
+int bruteMinLeft(const vector<long long> &A, int r, long long X) {
+  long long sm = 0;
+  int l = r + 1;
+  while (l - 1 >= 0 && sm + A[l - 1] <= X) sm += A[--l];
+  return l;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e5;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 40;
+    vector<long long> A(N);
+    for (auto &&a : A) a = rng() % 10;
+    SegmentTreeBottomUp<C1> ST(A);
+    int Q = 50;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 3;
+      if (t == 0 && N > 0) {
+        int j = rng() % N;
+        long long v = rng() % 10;
+        A[j] += v;
+        ST.update(j, v);
+      } else if (t == 1) {
+        int l = rng() % (N + 1);
+        long long X = rng() % (N * 10 + 1);
+        int r = ST.maxRight(l, [&] (long long s) { return s <= X; });
+        assert(r == bruteMaxRight(A, l, X));
+        checkSum = 31 * checkSum + r;
+      } else {
+        int r = int(rng() % (N + 1)) - 1;
+        long long X = rng() % (N * 10 + 1);
+        int l = ST.minLeft(r, [&] (long long s) { return s <= X; });
+        assert(l == bruteMinLeft(A, r, X));
+        checkSum = 31 * checkSum + l;
+      }
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (SegmentTreeBottomUp maxRight and minLeft) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e5;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 40;
+    vector<long long> A(N);
+    for (auto &&a : A) a = rng() % 10;
+    vector<C2::Data> B(N);
+    for (int i = 0; i < N; i++) B[i] = make_pair(A[i], 1);
+    SegmentTreeLazyBottomUp<C2> ST(B);
+    int Q = 50;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 4;
+      if (t == 0 && N > 0) {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        long long v = rng() % 10;
+        for (int j = l; j <= r; j++) A[j] += v;
+        ST.update(l, r, v);
+      } else if (t == 1) {
+        int l = rng() % (N + 1);
+        long long X = rng() % (N * 20 + 1);
+        int r = ST.maxRight(l, [&] (const C2::Data &s) { return s.first <= X; });
+        assert(r == bruteMaxRight(A, l, X));
+        checkSum = 31 * checkSum + r;
+      } else if (t == 2) {
+        int r = int(rng() % (N + 1)) - 1;
+        long long X = rng() % (N * 20 + 1);
+        int l = ST.minLeft(r, [&] (const C2::Data &s) { return s.first <= X; });
+        assert(l == bruteMinLeft(A, r, X));
+        checkSum = 31 * checkSum + l;
+      } else if (N > 0) {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        C2::Data q = ST.query(l, r);
+        assert(q.second == r - l + 1);
+        assert(q.first == accumulate(A.begin() + l, A.begin() + r + 1, 0LL));
+        checkSum = 31 * checkSum + q.first;
+      }
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (SegmentTreeLazyBottomUp maxRight and minLeft) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+bool isPrefix(const string &s, const string &t) {
+  return s.size() <= t.size() && t.compare(0, s.size(), s) == 0;
+}
+
+bool isSuffix(const string &s, const string &t) {
+  return s.size() <= t.size() && t.compare(t.size() - s.size(), s.size(), s) == 0;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 40;
+    vector<string> A(N);
+    for (auto &&a : A) a = string(1, char('a' + rng() % 2));
+    SegmentTreeBottomUp<C3> ST(A);
+    for (int i = 0; i < 50; i++) {
+      string T;
+      for (int j = rng() % 10; j > 0; j--) T += char('a' + rng() % 2);
+      if (rng() % 2 == 0) {
+        int l = rng() % (N + 1), r = ST.maxRight(l, [&] (const string &s) { return isPrefix(s, T); });
+        string agg;
+        int e = l - 1;
+        while (e + 1 < N && isPrefix(agg + A[e + 1], T)) agg += A[++e];
+        assert(r == e);
+        checkSum = 31 * checkSum + r;
+      } else {
+        int r = int(rng() % (N + 1)) - 1, l = ST.minLeft(r, [&] (const string &s) { return isSuffix(s, T); });
+        string agg;
+        int e = r + 1;
+        while (e - 1 >= 0 && isSuffix(A[e - 1] + agg, T)) agg = A[--e] + agg;
+        assert(l == e);
+        checkSum = 31 * checkSum + l;
+      }
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (non commutative merge) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 2 == 0 ? rng() % 10 + 1 : rng() % 300 + 1;
+    vector<long long> A(N);
+    for (auto &&a : A) a = rng() % C4::MOD;
+    SegmentTreeLazyBottomUp<C4> ST(A), ST2(A);
+    for (int b = 0; b < 3; b++) {
+      int Q = rng() % 2 == 0 ? rng() % 5 : rng() % 200;
+      vector<int> endpoints(rng() % 2 == 0 ? N : rng() % 8 + 1);
+      for (auto &&e : endpoints) e = rng() % N;
+      vector<SegmentTreeLazyBottomUp<C4>::BatchOp> ops;
+      vector<long long> expected;
+      for (int i = 0; i < Q; i++) {
+        int l = endpoints[rng() % endpoints.size()], r = endpoints[rng() % endpoints.size()];
+        if (l > r) swap(l, r);
+        if (rng() % 2 == 0) {
+          C4::Lazy v = make_pair(rng() % C4::MOD, rng() % C4::MOD);
+          ops.push_back({true, l, r, v});
+          ST2.update(l, r, v);
+        } else {
+          ops.push_back({false, l, r, C4::ldef()});
+          expected.push_back(ST2.query(l, r));
+        }
+      }
+      assert(ST.batch(ops) == expected);
+      for (auto &&e : expected) checkSum = 31 * checkSum + e;
+      for (int i = 0; i < 20; i++) {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        assert(ST.query(l, r) == ST2.query(l, r));
+      }
+      if (rng() % 2 == 0) {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        C4::Lazy v = make_pair(rng() % C4::MOD, rng() % C4::MOD);
+        ST.update(l, r, v);
+        ST2.update(l, r, v);
+      }
+    }
+    for (int i = 0; i < N; i++) assert(ST.query(i, i) == ST2.query(i, i));
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (SegmentTreeLazyBottomUp batch) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  cout << "Test Passed" << endl;
+  return 0;
+}
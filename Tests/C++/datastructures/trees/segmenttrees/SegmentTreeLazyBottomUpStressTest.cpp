@@ -0,0 +1,83 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeLazyBottomUp.h"
+using namespace std;
+
+struct C {
+  using Data = long long;
+  using Lazy = long long;
+  static Data qdef() { return 0; }
+  static Lazy ldef() { return 0; }
+  static Data merge(const Data &l, const Data &r) { return l + r; }
+  static Data applyLazy(const Data &l, const Lazy &r, int k) { return l + r * k; }
+  static Lazy mergeLazy(const Lazy &l, const Lazy &r) { return l + r; }
+};
+
+using ST = SegmentTreeLazyBottomUp<C>;
+
+const int N = 1e7, Q = 2e6;
+
+// runs the operations sequentially and in batches of each size, and returns a checksum of the query results
+long long bench(const vector<long long> &A, const vector<ST::BatchOp> &ops, const vector<int> &sizes) {
+  vector<long long> expected;
+  {
+    ST T(A);
+    const auto start_time = chrono::system_clock::now();
+    for (auto &&o : ops) {
+      if (o.isUpdate) T.update(o.l, o.r, o.v);
+      else expected.push_back(T.query(o.l, o.r));
+    }
+    const auto end_time = chrono::system_clock::now();
+    double sec = (end_time - start_time).count() / double(chrono::system_clock::period::den);
+    cout << "  Time (sequential): " << fixed << setprecision(3) << sec << "s" << endl;
+  }
+  for (int B : sizes) {
+    ST T(A);
+    vector<long long> ans;
+    const auto start_time = chrono::system_clock::now();
+    for (int i = 0; i < Q; i += B) {
+      vector<long long> res = T.batch(vector<ST::BatchOp>(ops.begin() + i, ops.begin() + min(Q, i + B)));
+      ans.insert(ans.end(), res.begin(), res.end());
+    }
+    const auto end_time = chrono::system_clock::now();
+    assert(ans == expected);
+    double sec = (end_time - start_time).count() / double(chrono::system_clock::period::den);
+    cout << "  Time (batches of " << B << "): " << fixed << setprecision(3) << sec << "s" << endl;
+  }
+  long long checkSum = 0;
+  for (auto &&e : expected) checkSum = 31 * checkSum + e;
+  return checkSum;
+}
+
+vector<ST::BatchOp> randomOps(mt19937_64 &rng, const vector<int> &endpoints) {
+  vector<ST::BatchOp> ops(Q);
+  for (auto &&o : ops) {
+    o.l = endpoints[rng() % endpoints.size()];
+    o.r = endpoints[rng() % endpoints.size()];
+    if (o.l > o.r) swap(o.l, o.r);
+    o.isUpdate = rng() % 2 == 0;
+    o.v = o.isUpdate ? rng() % int(1e6) + 1 : 0;
+  }
+  return ops;
+}
+
+int main() {
+  mt19937_64 rng(0);
+  vector<long long> A(N);
+  for (auto &&a : A) a = rng() % int(1e6) + 1;
+  vector<int> all(N);
+  iota(all.begin(), all.end(), 0);
+  vector<ST::BatchOp> ops = randomOps(rng, all);
+  cout << "Subtest 1 (random range add and range sum) Passed" << endl;
+  cout << "  N: " << N << ", Q: " << Q << endl;
+  long long checkSum = bench(A, ops, {1000, 100000, Q});
+  cout << "  Checksum: " << checkSum << endl;
+  vector<int> few(4096);
+  for (auto &&e : few) e = rng() % N;
+  ops = randomOps(rng, few);
+  cout << "Subtest 2 (range add and range sum with 4096 distinct endpoints) Passed" << endl;
+  cout << "  N: " << N << ", Q: " << Q << endl;
+  checkSum = bench(A, ops, {1000, 100000, Q});
+  cout << "  Checksum: " << checkSum << endl;
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeWide.h"
+using namespace std;
+
+struct Max {
+  long long operator () (long long a, long long b) const { return max(a, b); }
+};
+
+template <const int B> void test(int subtest, bool construct) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(subtest);
+  const int TESTCASES = 2e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 2 == 0 ? rng() % 40 : rng() % 700;
+    vector<long long> A(N);
+    for (auto &&a : A) a = rng() % 10;
+    SegmentTreeWide<long long, B> ST(construct ? SegmentTreeWide<long long, B>(A) : SegmentTreeWide<long long, B>(N));
+    if (!construct) for (int i = 0; i < N; i++) ST.update(i, A[i]);
+    SegmentTreeWide<long long, B, Max> MX(A, LLONG_MIN, Max());
+    if (ti % 2 == 1) {
+      vector<char> pad(rng() % 256 + 1);
+      SegmentTreeWide<long long, B> CP(ST);
+      for (int h = 0; h < CP.H; h++) assert(reinterpret_cast<uintptr_t>(CP.level(h)) % (B * sizeof(long long)) == 0);
+      ST = CP;
+      auto MXCP = MX;
+      MX = MXCP;
+    }
+    for (int h = 0; h < ST.H; h++) {
+      assert(reinterpret_cast<uintptr_t>(ST.level(h)) % (B * sizeof(long long)) == 0);
+      assert(reinterpret_cast<uintptr_t>(MX.level(h)) % (B * sizeof(long long)) == 0);
+    }
+    for (int i = 0; i < 50; i++) {
+      int t = rng() % 4;
+      if (t == 0 && N > 0) {
+        int j = rng() % N;
+        long long v = rng() % 10;
+        A[j] += v;
+        ST.update(j, v);
+        MX.update(j, A[j]);
+      } else if (t == 1 && N > 0) {
+        int l = rng() % N, r = rng() % N;
+        if (l > r) swap(l, r);
+        long long sm = accumulate(A.begin() + l, A.begin() + r + 1, 0LL);
+        assert(ST.query(l, r) == sm);
+        assert(MX.query(r) == *max_element(A.begin(), A.begin() + r + 1));
+        checkSum = 31 * checkSum + sm;
+      } else if (t == 2) {
+        long long v = rng() % (N * 10 + 2);
+        int e = 0;
+        long long sm = 0;
+        while (e < N && sm + A[e] < v) sm += A[e++];
+        assert(ST.bsearch(v) == e);
+        e = 0;
+        sm = 0;
+        while (e < N && sm + A[e] <= v) sm += A[e++];
+        assert(ST.bsearch(v, less_equal<long long>()) == e);
+        checkSum = 31 * checkSum + e;
+      } else {
+        long long v = rng() % 20;
+        int e = 0;
+        while (e < N && A[e] < v) e++;
+        assert(MX.bsearch(v) == e);
+        checkSum = 31 * checkSum + e;
+      }
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (B = " << B << ", " << (construct ? "vector" : "size") << " constructor) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<2>(1, true);
+  test<4>(2, false);
+  test<8>(3, true);
+  test<16>(4, false);
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <bits/stdc++.h>
+#include "../../../../../Content/C++/datastructures/trees/fenwicktrees/FenwickTree1D.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeBottomUp.h"
+#include "../../../../../Content/C++/datastructures/trees/segmenttrees/SegmentTreeWide.h"
+using namespace std;
+
+struct C {
+  using Data = long long;
+  using Lazy = long long;
+  static Data qdef() { return 0; }
+  static Data merge(const Data &l, const Data &r) { return l + r; }
+  static Data applyLazy(const Data &l, const Lazy &r) { return l + r; }
+};
+
+const int N = 1e7, Q = 1e7;
+
+template <class F> vector<int> bench(const string &name, const vector<long long> &V, F f) {
+  const auto start_time = chrono::system_clock::now();
+  vector<int> ret;
+  ret.reserve(V.size());
+  for (auto &&v : V) ret.push_back(f(v));
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "  Time (" << name << "): " << fixed << setprecision(3) << sec << "s" << endl;
+  return ret;
+}
+
+int main() {
+  mt19937_64 rng(0);
+  vector<long long> A(N);
+  for (auto &&a : A) a = rng() % int(1e6) + 1;
+  long long total = accumulate(A.begin(), A.end(), 0LL);
+  vector<long long> V(Q);
+  for (auto &&v : V) v = rng() % total + 1;
+  vector<long long> W(V.begin(), V.begin() + Q / 10);
+  FenwickTree1D<long long> FT(A);
+  SegmentTreeBottomUp<C> ST(A);
+  SegmentTreeWide<long long, 8> W8(A);
+  SegmentTreeWide<long long, 16> W16(A);
+  cout << "Subtest 1 (first prefix at least X) Passed" << endl;
+  cout << "  N: " << N << ", Q: " << Q << endl;
+  vector<int> ans = bench("FenwickTree1D bsearch", V, [&] (long long v) { return FT.bsearch(v, less<long long>()); });
+  assert(ans == bench("SegmentTreeBottomUp maxRight", V, [&] (long long v) { return ST.maxRight(0, [&] (long long s) { return s < v; }) + 1; }));
+  assert(ans == bench("SegmentTreeWide<8> bsearch", V, [&] (long long v) { return W8.bsearch(v); }));
+  assert(ans == bench("SegmentTreeWide<16> bsearch", V, [&] (long long v) { return W16.bsearch(v); }));
+  vector<int> part = bench("binary search over FenwickTree1D query, Q / 10", W, [&] (long long v) {
+    int lo = 0, hi = N;
+    while (lo < hi) {
+      int mid = lo + (hi - lo) / 2;
+      if (FT.query(mid) < v) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo;
+  });
+  assert(equal(part.begin(), part.end(), ans.begin()));
+  long long checkSum = 0;
+  for (auto &&a : ans) checkSum = 31 * checkSum + a;
+  cout << "  Checksum: " << checkSum << endl;
+  vector<int> idx(Q);
+  for (auto &&i : idx) i = rng() % N;
+  const auto start_time = chrono::system_clock::now();
+  long long sm = 0;
+  for (auto &&i : idx) sm += FT.query(i);
+  const auto mid_time = chrono::system_clock::now();
+  for (auto &&i : idx) sm -= W16.query(i);
+  const auto end_time = chrono::system_clock::now();
+  assert(sm == 0);
+  cout << "Subtest 2 (prefix queries) Passed" << endl;
+  cout << "  Time (FenwickTree1D): " << fixed << setprecision(3) << (mid_time - start_time).count() / double(chrono::system_clock::period::den) << "s" << endl;
+  cout << "  Time (SegmentTreeWide<16>): " << fixed << setprecision(3) << (end_time - mid_time).count() / double(chrono::system_clock::period::den) << "s" << endl;
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,144 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/BigInt.h"
+#include "../../../Content/C++/math/BinaryBigInt.h"
+using namespace std;
+
+using Limbs = BinaryBigInt::Limbs;
+
+string randomDigits(mt19937_64 &rng, int len) {
+  string s(len, '0');
+  for (auto &&c : s) c = rng() % 4 == 0 ? '9' : char('0' + rng() % 10);
+  if (rng() % 4 == 0) s[0] = '1';
+  else if (rng() % 8 == 0) s = "-" + s;
+  return s;
+}
+
+Limbs randomLimbs(mt19937_64 &rng, int len) {
+  Limbs x(len);
+  for (auto &&xi : x) xi = rng() % 4 == 0 ? UINT32_MAX : uint32_t(rng());
+  if (len > 0 && x.back() == 0) x.back() = 1;
+  return x;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 2000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 20 + 1, M = rng() % 20 + 1;
+    long long x = rng() % 2 == 0 ? (long long)(rng()) : (long long)(rng() % 1000) - 500;
+    long long y = rng() % 2 == 0 ? (long long)(rng() % 2000000) - 1000000 : (long long)(rng());
+    if (y == 0) y = 1;
+    BinaryBigInt bx(x), by(y);
+    assert(bx.value() == x && by.value() == y);
+    assert(bx.write() == to_string(x));
+    assert((bx / by).value() == x / y && (bx % by).value() == x % y);
+    assert((bx < by) == (x < y) && (bx == by) == (x == y));
+    string s = randomDigits(rng, N), t = randomDigits(rng, M);
+    BinaryBigInt a(s), b(t);
+    BigInt ea(s), eb(t);
+    assert(a.write() == ea.write() && b.write() == eb.write());
+    assert((a + b).write() == (ea + eb).write());
+    assert((a - b).write() == (ea - eb).write());
+    assert((a * b).write() == (ea * eb).write());
+    if (!b.isZero()) {
+      assert((a / b).write() == (ea / eb).write());
+      assert((a % b).write() == (ea % eb).write());
+    }
+    assert((a < b) == (ea < eb) && (a == b) == (ea == eb));
+    checkSum = 31 * checkSum + (a * b).a.size();
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (small values) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 2500 + 1, M = rng() % 2 == 0 ? rng() % 2500 + 1 : rng() % N + 1;
+    Limbs x = randomLimbs(rng, N), y = randomLimbs(rng, M);
+    Limbs c = BinaryBigInt::mulSchoolbook(x, y);
+    if (min(N, M) >= 2) assert(BinaryBigInt::mulKaratsuba(x, y) == c);
+    if (min(N, M) >= 3) assert(BinaryBigInt::mulToom3(x, y) == c);
+    assert(BinaryBigInt::mulNTT(x, y) == c);
+    assert(BinaryBigInt::mul(x, y) == c);
+    assert(BinaryBigInt::mulNTT(x, x) == BinaryBigInt::mulSchoolbook(x, x));
+    Limbs r, q = BinaryBigInt::divMod(c, y, r);
+    Limbs r2, q2 = BinaryBigInt::divSchoolbook(c, y, r2);
+    assert(q == x && r.empty() && q2 == x && r2.empty());
+    Limbs d = c;
+    BinaryBigInt::subFrom(d, Limbs(1, 1));
+    q = BinaryBigInt::divMod(d, y, r);
+    q2 = BinaryBigInt::divSchoolbook(d, y, r2);
+    assert(q == q2 && r == r2);
+    for (auto &&ci : c) checkSum = 31 * checkSum + ci;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (multiplication and division paths) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(2);
+  const int TESTCASES = 40;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 20000 + 1, M = rng() % 2 == 0 ? rng() % 20000 + 1 : rng() % N + 1;
+    string s = randomDigits(rng, N), t = randomDigits(rng, M);
+    BinaryBigInt a(s), b(t);
+    BigInt ea(s), eb(t);
+    assert(a.write() == ea.write() && b.write() == eb.write());
+    assert((a * b).write() == (ea * eb).write());
+    if (!b.isZero()) {
+      assert((a / b).write() == (ea / eb).write());
+      assert((a % b).write() == (ea % eb).write());
+    }
+    checkSum = 31 * checkSum + (a * b).a.size();
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (large values against BigInt) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(3);
+  const int N = 1000000;
+  string s = randomDigits(rng, N), t = randomDigits(rng, N / 2);
+  BinaryBigInt a(s), b(t);
+  assert(a.write() == BigInt(s).write());
+  BinaryBigInt c = a * b;
+  pair<BinaryBigInt, BinaryBigInt> qr = divmod(c + a, a);
+  assert(qr.first == b + 1 && qr.second.isZero());
+  qr = divmod(a, b);
+  assert(qr.first * b + qr.second == a && qr.second.abs() < b.abs());
+  long long checkSum = 0;
+  for (auto &&ci : c.write()) checkSum = 31 * checkSum + ci;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (million digits) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -301,6 +301,60 @@ void test11() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test12() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e6;
+  const int N = 1e6;
+  long long checkSum = 0;
+  CombinatoricsModPrime<long long> C(N * 2 + 1, MOD2);
+  BinomialTable<long long> B(MOD2);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int n = rng() % (1 << (rng() % 21)) % (N + 1), k = rng() % (n + 2) - 1;
+    long long c = k < 0 ? 0 : C.choose(n, k);
+    assert(B.choose(n, k) == c);
+    assert(B.permute(n, k) == (k < 0 ? 0 : C.permute(n, k)));
+    assert(B.factorial(n) == C.factorial(n) && B.invFactorial(n) == C.invFactorial(n));
+    if (n > 0 && k >= 0) assert(B.multiChoose(n, k) == C.multiChoose(n, k));
+    assert(B.catalan(n) == mulMod(C.choose(n * 2, n), mulInvModPrime((long long)(n + 1), MOD2), MOD2));
+    checkSum = 31 * checkSum + c;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 12 (Binomial Table Mod Prime) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test13() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 2e5;
+  const int N = 1000;
+  const vector<pair<long long, int>> MODS = {{2, 1}, {2, 2}, {2, 3}, {2, 10}, {3, 1}, {3, 4}, {5, 3}, {7, 1}, {7, 2}, {11, 3}, {997, 1}};
+  long long checkSum = 0;
+  for (auto &&pe : MODS) {
+    BinomialTable<long long> B(pe.first, pe.second);
+    long long M = B.M;
+    vector<vector<long long>> C = pascalsTriangleMod(N * 2 + 1, M);
+    for (int ti = 0; ti < TESTCASES / int(MODS.size()); ti++) {
+      int n = rng() % (N + 1), k = rng() % (n + 1);
+      assert(B.choose(n, k) == C[n][k] % M);
+      assert(B.permute(n, k) == permuteMod<long long>(n, k, M));
+      assert(B.factorial(n) == factorialMod<long long>(n, M));
+      if (n > 0) assert(B.multiChoose(n, k) == C[n + k - 1][k] % M);
+      if (n == 0) assert(B.catalan(n) == 1 % M);
+      else assert(B.catalan(n) == subMod(C[n * 2][n], C[n * 2][n + 1], M));
+      checkSum = 31 * checkSum + B.choose(n, k);
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 13 (Binomial Table Mod Prime Power) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
@@ -313,6 +367,8 @@ int main() {
   test9();
   test10();
   test11();
+  test12();
+  test13();
   cout << "Test Passed" << endl;
   return 0;
 }
@@ -0,0 +1,83 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/DynamicIntMod.h"
+#include "../../../Content/C++/math/ModularArithmetic.h"
+using namespace std;
+
+using IM = DynamicIntMod<long long>;
+
+const int N = 1 << 12, ROUNDS = 5000;
+
+// multiplies each element of A by the corresponding element of B, ROUNDS times, as a dependent chain
+template <class F> double bench(vector<long long> &A, const vector<long long> &B, F mul) {
+  const auto start_time = chrono::system_clock::now();
+  for (int i = 0; i < N; i++) for (int r = 0; r < ROUNDS; r++) A[i] = mul(A[i], B[i]);
+  const auto end_time = chrono::system_clock::now();
+  return (end_time - start_time).count() / double(chrono::system_clock::period::den);
+}
+
+void test(int subtest, const string &name, long long mod, bool mulOverflow, bool slowBaseline) {
+  mt19937_64 rng(subtest);
+  IM::setMod(mod, false, mulOverflow);
+  vector<long long> A(N), B(N);
+  for (auto &&a : A) a = rng() % mod;
+  for (auto &&b : B) b = rng() % mod;
+  vector<long long> C = A, D = A;
+  double baseline = mulOverflow ? bench(C, B, [&] (long long a, long long b) {
+    return (long long)(__uint128_t(a) * b % mod);
+  }) : bench(C, B, [&] (long long a, long long b) { return a * b % mod; });
+  double dynamic = bench(D, B, [&] (long long a, long long b) { return (IM(a) * IM(b)).v; });
+  assert(C == D);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  MOD: " << mod << endl;
+  cout << "  Time (%): " << fixed << setprecision(3) << baseline << "s" << endl;
+  cout << "  Time (DynamicIntMod): " << fixed << setprecision(3) << dynamic << "s" << endl;
+  if (slowBaseline) {
+    vector<long long> E = A;
+    const int SLOW_ROUNDS = 50;
+    const auto start_time = chrono::system_clock::now();
+    for (int i = 0; i < N; i++) for (int r = 0; r < SLOW_ROUNDS; r++) E[i] = mulModOvf(E[i], B[i], mod);
+    const auto end_time = chrono::system_clock::now();
+    double sec = (end_time - start_time).count() / double(chrono::system_clock::period::den) * ROUNDS / SLOW_ROUNDS;
+    cout << "  Time (doubling, extrapolated): " << fixed << setprecision(3) << sec << "s" << endl;
+  }
+  long long checkSum = 0;
+  for (auto &&d : D) checkSum = 31 * checkSum + d;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test5() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(5);
+  const int TESTCASES = 1e4, OPS = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int bits = rng() % 62 + 1;
+    long long mod = rng() % (1LL << bits) + 1;
+    if (ti % 10 == 0) mod = (1LL << bits) - rng() % 3;
+    if (mod <= 0) mod = 1;
+    bool mulOverflow = mod > (long long)(3e9);
+    IM::setMod(mod, false, mulOverflow);
+    for (int k = 0; k < OPS; k++) {
+      long long a = rng() % mod, b = rng() % 2 == 0 ? mod - 1 : rng() % mod;
+      long long c = (long long)(__uint128_t(a) * b % mod);
+      assert((IM(a) * IM(b)).v == c);
+      checkSum = 31 * checkSum + c;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = (end_time - start_time).count() / double(chrono::system_clock::period::den);
+  cout << "Subtest 5 (random moduli) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  mt19937_64 rng(0);
+  test(1, "small modulus", 1e9 + 7 + rng() % 2, false, false);
+  test(2, "near 2^31.5", 3037000493LL, false, false);
+  test(3, "62-bit modulus", (1LL << 62) - 57 + rng() % 2, true, true);
+  test(4, "63-bit modulus", LLONG_MAX - 24 - rng() % 2, true, false);
+  test5();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/dp/SumOverSubsets.h"
+#include "../../../Content/C++/math/FST.h"
+using namespace std;
+
+template <const int TYPE, class T> void naiveFst(vector<T> &a, bool inv) {
+  int N = a.size();
+  for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1) for (int j = 0; j < len; j++) {
+    T &u = a[i + j], &v = a[len + i + j];
+    if (TYPE == OR) tie(u, v) = inv ? make_pair(v, u - v) : make_pair(u + v, u);
+    else if (TYPE == AND) tie(u, v) = inv ? make_pair(v - u, u) : make_pair(v, u + v);
+    else tie(u, v) = make_pair(u + v, u - v);
+  }
+  if (TYPE == XOR && inv) for (auto &&ai : a) ai /= T(N);
+}
+
+template <const bool TYPE, class T> void naiveSos(vector<T> &a, bool inv) {
+  int N = a.size();
+  for (int m = 1; m < N; m <<= 1) for (int mask = 0; mask < N; mask++) if (bool(mask & m) == TYPE) {
+    if (inv) a[mask] -= a[mask ^ m];
+    else a[mask] += a[mask ^ m];
+  }
+}
+
+template <class T> void check(mt19937_64 &rng, int N, int threads, long long &checkSum) {
+  vector<T> a(N);
+  for (auto &&ai : a) ai = T(rng() % 1000) - T(500);
+  for (int inv = 0; inv < 2; inv++) {
+    vector<T> b = a, c = a;
+    fst<OR>(b, inv, threads); naiveFst<OR>(c, inv); assert(b == c);
+    b = a; c = a;
+    fst<AND>(b, inv, threads); naiveFst<AND>(c, inv); assert(b == c);
+    b = a; c = a;
+    naiveFst<XOR>(b, false); c = b;
+    fst<XOR>(b, inv, threads); naiveFst<XOR>(c, inv); assert(b == c);
+    b = a; c = a;
+    sos<SUBSET>(b, inv, threads); naiveSos<SUBSET>(c, inv); assert(b == c);
+    b = a; c = a;
+    sos<SUPERSET>(b, inv, threads); naiveSos<SUPERSET>(c, inv); assert(b == c);
+    for (auto &&bi : b) checkSum = 31 * checkSum + (long long)(bi);
+  }
+  vector<T> b = a;
+  fst<XOR>(b, false, threads); fst<XOR>(b, true, threads); assert(a == b);
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = 1 << (rng() % 21), threads = rng() % 4 + 1;
+    if (ti % 2 == 0) N = 1 << (rng() % 8);
+    if (ti % 3 == 0) check<long long>(rng, N, threads, checkSum);
+    else if (ti % 3 == 1) check<int>(rng, N, threads, checkSum);
+    else check<double>(rng, N, threads, checkSum);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (fst and sos against the bit by bit loops) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 200;
+  const long long MOD = 998244353;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int n = ti % 20 == 0 ? rng() % 15 : rng() % 12, N = 1 << n, threads = rng() % 4 + 1;
+    vector<long long> a(N), b(N), c(N, 0);
+    for (auto &&ai : a) ai = rng() % 1000;
+    for (auto &&bi : b) bi = rng() % 1000;
+    for (int i = 0; i < N; i++) for (int j = i;; j = (j - 1) & i) {
+      c[i] += a[j] * b[i ^ j];
+      if (j == 0) break;
+    }
+    assert(subsetConvolution(a, b, threads) == c);
+    vector<uint64_t> ua(a.begin(), a.end()), ub(b.begin(), b.end());
+    vector<uint64_t> uc = subsetConvolution(ua, ub, threads);
+    assert(vector<uint64_t>(c.begin(), c.end()) == uc);
+    for (auto &&ci : c) checkSum = 31 * checkSum + ci % MOD;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (subset convolution) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
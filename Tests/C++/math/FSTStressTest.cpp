@@ -0,0 +1,84 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/dp/SumOverSubsets.h"
+#include "../../../Content/C++/math/FST.h"
+using namespace std;
+
+template <const int TYPE, class T> void naiveFst(vector<T> &a, bool inv) {
+  int N = a.size();
+  for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1) for (int j = 0; j < len; j++) {
+    T &u = a[i + j], &v = a[len + i + j];
+    if (TYPE == OR) tie(u, v) = inv ? make_pair(v, u - v) : make_pair(u + v, u);
+    else if (TYPE == AND) tie(u, v) = inv ? make_pair(v - u, u) : make_pair(v, u + v);
+    else tie(u, v) = make_pair(u + v, u - v);
+  }
+  if (TYPE == XOR && inv) for (auto &&ai : a) ai /= T(N);
+}
+
+template <const bool TYPE, class T> void naiveSos(vector<T> &a, bool inv) {
+  int N = a.size();
+  for (int m = 1; m < N; m <<= 1) for (int mask = 0; mask < N; mask++) if (bool(mask & m) == TYPE) {
+    if (inv) a[mask] -= a[mask ^ m];
+    else a[mask] += a[mask ^ m];
+  }
+}
+
+template <class F> double timeIt(F f) {
+  const auto start_time = chrono::system_clock::now();
+  f();
+  const auto end_time = chrono::system_clock::now();
+  return (end_time - start_time).count() / double(chrono::system_clock::period::den);
+}
+
+// bytes read and written by one pass per bit over the array
+double gbps(long long N, int elemSize, double sec) {
+  return 2.0 * N * elemSize * __builtin_ctzll(N) / sec / 1e9;
+}
+
+template <class T, class F, class G> void bench(int subtest, const string &name, int LG, F fast, G slow) {
+  mt19937_64 rng(subtest);
+  int N = 1 << LG;
+  vector<T> a(N);
+  for (auto &&ai : a) ai = T(rng() % 1000);
+  vector<T> b = a, c = a, d = a;
+  double slowSec = timeIt([&] { slow(b); });
+  double fastSec = timeIt([&] { fast(c, 1); });
+  double threadSec = timeIt([&] { fast(d, 4); });
+  assert(b == c && b == d);
+  long long checkSum = 0;
+  for (int i = 0; i < N; i += 997) checkSum = 31 * checkSum + (long long)(c[i]);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  N: 2^" << LG << endl;
+  cout << "  Time (bit by bit): " << fixed << setprecision(3) << slowSec << "s, " << gbps(N, sizeof(T), slowSec) << " GB/s" << endl;
+  cout << "  Time (blocked): " << fixed << setprecision(3) << fastSec << "s, " << gbps(N, sizeof(T), fastSec) << " GB/s" << endl;
+  cout << "  Time (blocked, 4 threads): " << fixed << setprecision(3) << threadSec << "s, " << gbps(N, sizeof(T), threadSec) << " GB/s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test5() {
+  mt19937_64 rng(5);
+  const int LG = 20, N = 1 << LG;
+  vector<uint32_t> a(N), b(N);
+  for (auto &&ai : a) ai = rng();
+  for (auto &&bi : b) bi = rng();
+  vector<uint32_t> c, d;
+  double sec = timeIt([&] { c = subsetConvolution(a, b); });
+  double threadSec = timeIt([&] { d = subsetConvolution(a, b, 4); });
+  assert(c == d);
+  long long checkSum = 0;
+  for (int i = 0; i < N; i += 97) checkSum = 31 * checkSum + c[i];
+  cout << "Subtest 5 (subset convolution) Passed" << endl;
+  cout << "  N: 2^" << LG << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Time (4 threads): " << fixed << setprecision(3) << threadSec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  bench<long long>(1, "fst OR, 64-bit", 24, [] (vector<long long> &a, int t) { fst<OR>(a, false, t); }, [] (vector<long long> &a) { naiveFst<OR>(a, false); });
+  bench<int>(2, "fst XOR, 32-bit", 24, [] (vector<int> &a, int t) { fst<XOR>(a, false, t); }, [] (vector<int> &a) { naiveFst<XOR>(a, false); });
+  bench<long long>(3, "sos SUBSET, 64-bit", 24, [] (vector<long long> &a, int t) { sos<SUBSET>(a, false, t); }, [] (vector<long long> &a) { naiveSos<SUBSET>(a, false); });
+  bench<uint32_t>(4, "sos SUPERSET inverse, 32-bit", 25, [] (vector<uint32_t> &a, int t) { sos<SUPERSET>(a, true, t); }, [] (vector<uint32_t> &a) { naiveSos<SUPERSET>(a, true); });
+  test5();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,168 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/FormalPowerSeries.h"
+using namespace std;
+
+const long long MOD = 998244353;
+using Poly = FPS<long long, MOD>;
+
+Poly naiveMulTrunc(const Poly &a, const Poly &b, int n) {
+  Poly c(n, 0);
+  for (int i = 0; i < int(a.size()) && i < n; i++) for (int j = 0; j < int(b.size()) && i + j < n; j++)
+    c[i + j] = (c[i + j] + a[i] * b[j]) % MOD;
+  return c;
+}
+
+Poly naiveInv(const Poly &f, int n) {
+  Poly g(n, 0);
+  long long i0 = mulInvModPrime(f[0], MOD);
+  g[0] = i0;
+  for (int i = 1; i < n; i++) {
+    long long s = 0;
+    for (int j = 1; j <= i && j < int(f.size()); j++) s = (s + f[j] * g[i - j]) % MOD;
+    g[i] = (MOD - s) % MOD * i0 % MOD;
+  }
+  return g;
+}
+
+Poly naiveExp(const Poly &f, int n) {
+  // g' = f' g
+  Poly g(n, 0);
+  if (n == 0) return g;
+  g[0] = 1;
+  for (int i = 1; i < n; i++) {
+    long long s = 0;
+    for (int j = 1; j <= i && j < int(f.size()); j++) s = (s + f[j] * j % MOD * g[i - j]) % MOD;
+    g[i] = s * mulInvModPrime((long long)(i), MOD) % MOD;
+  }
+  return g;
+}
+
+Poly randomPoly(mt19937_64 &rng, int n) {
+  Poly f(n);
+  for (auto &&fi : f) fi = rng() % 3 == 0 ? rng() % 3 : rng() % MOD;
+  return f;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 300 + 1, n = rng() % 300 + 1;
+    Poly f = randomPoly(rng, N);
+    f[0] = rng() % (MOD - 1) + 1;
+    Poly g = f.inv(n);
+    assert(g == naiveInv(f, n));
+    Poly one(n, 0);
+    one[0] = 1;
+    assert(naiveMulTrunc(f, g, n) == one);
+    f[0] = 1;
+    Poly l = f.log(n);
+    assert(naiveExp(l, n) == naiveMulTrunc(f, Poly(1, 1), n));
+    l[0] = 0;
+    assert(l.exp(n) == naiveExp(l, n));
+    for (auto &&x : g) checkSum = 31 * checkSum + x;
+    for (auto &&x : l) checkSum = 31 * checkSum + x;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (inv, log, exp) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 100 + 1, n = rng() % 200 + 1;
+    Poly f = randomPoly(rng, N);
+    int z = rng() % 4;
+    for (int i = 0; i < z && i < N; i++) f[i] = 0;
+    Poly s = f.sqrt(n);
+    if (s.empty()) {
+      int nz = 0;
+      while (nz < N && f[nz] == 0) nz++;
+      assert(nz % 2 == 1 || sqrtMod(f[nz], MOD) == -1);
+    } else {
+      assert(int(s.size()) == n);
+      assert(naiveMulTrunc(s, s, n) == naiveMulTrunc(f, Poly(1, 1), n));
+    }
+    unsigned long long k = rng() % 4 == 0 ? rng() : rng() % 10;
+    Poly p = f.pow(k, n);
+    if (k < 10) {
+      Poly q(n, 0);
+      q[0] = 1;
+      for (unsigned long long i = 0; i < k; i++) q = naiveMulTrunc(q, f, n);
+      assert(p == q);
+    } else {
+      assert(naiveMulTrunc(p, f, n) == naiveMulTrunc(f.pow(k + 1, n), Poly(1, 1), n) || f[0] == 0);
+    }
+    for (auto &&x : s) checkSum = 31 * checkSum + x;
+    for (auto &&x : p) checkSum = 31 * checkSum + x;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (sqrt, pow) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(2);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 300 + 1, M = rng() % 300 + 1;
+    Poly a = randomPoly(rng, N), b = randomPoly(rng, M);
+    b.back() = rng() % (MOD - 1) + 1;
+    pair<Poly, Poly> qr = a.divMod(b);
+    Poly q = qr.first, r = qr.second;
+    assert(int(r.size()) == M - 1);
+    assert(int(q.size()) == max(0, N - M + 1));
+    Poly c = naiveMulTrunc(b, q, max(N, M)) + r;
+    c.resize(N);
+    assert(c == a);
+    assert(a / b == q && a % b == r);
+    for (auto &&x : q) checkSum = 31 * checkSum + x;
+    for (auto &&x : r) checkSum = 31 * checkSum + x;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (divMod) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(3);
+  int N = 1 << 19;
+  Poly f = randomPoly(rng, N);
+  f[0] = 0;
+  Poly e = f.exp();
+  Poly l = e.log();
+  assert(l == f);
+  Poly g = e.inv();
+  long long checkSum = 0;
+  for (auto &&x : g) checkSum = 31 * checkSum + x;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (large exp, log, inv) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  cout << "Test Passed" << endl;
+  return 0;
+}
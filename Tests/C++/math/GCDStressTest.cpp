@@ -0,0 +1,144 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/GCD.h"
+using namespace std;
+
+double elapsed(chrono::system_clock::time_point start_time) {
+  return (chrono::system_clock::now() - start_time).count() / double(chrono::system_clock::period::den);
+}
+
+long long randomValue(mt19937_64 &rng, long long mx) {
+  switch (rng() % 4) {
+    case 0: return rng() % 100;
+    case 1: return (long long)(rng() % mx) >> 4 << 4;
+    default: return rng() % mx;
+  }
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e6;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long mx = 1LL << (rng() % 61 + 1);
+    long long a = randomValue(rng, mx), b = randomValue(rng, mx);
+    if (rng() % 4 == 0) a = -a;
+    if (rng() % 4 == 0) b = -b;
+    long long g = gcd(a, b);
+    assert(binaryGCD(a, b) == g);
+    assert(binaryGCD((unsigned long long)(abs(a)), (unsigned long long)(abs(b))) == (unsigned long long)(g));
+    assert(binaryGCD(int(a % INT_MAX), int(b % INT_MAX)) == gcd(int(a % INT_MAX), int(b % INT_MAX)));
+    long long x, y;
+    assert(binaryEEA(a, b, x, y) == g);
+    assert((__int128_t)(a) * x + (__int128_t)(b) * y == g);
+    long long m = abs(b) + 1, r = abs(a) % m;
+    long long inv = mulInv(r, m);
+    assert(binaryMulInv(r, m) == inv);
+    checkSum = 31 * checkSum + g + inv;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against gcd, EEA, and mulInv) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  mt19937_64 rng(1);
+  const int N = 1e7;
+  vector<long long> A(N), B(N);
+  for (auto &&a : A) a = rng() % (1LL << 62);
+  for (auto &&b : B) b = rng() % (1LL << 62);
+  long long s1 = 0, s2 = 0;
+  auto start_time = chrono::system_clock::now();
+  for (int i = 0; i < N; i++) s1 += gcd(A[i], B[i]);
+  double slow = elapsed(start_time);
+  start_time = chrono::system_clock::now();
+  for (int i = 0; i < N; i++) s2 += binaryGCD(A[i], B[i]);
+  double fast = elapsed(start_time);
+  assert(s1 == s2);
+  long long s3 = 0, s4 = 0;
+  start_time = chrono::system_clock::now();
+  for (int i = 0; i < N; i++) {
+    long long x, y;
+    s3 += EEA(A[i], B[i], x, y);
+  }
+  double slowEEA = elapsed(start_time);
+  start_time = chrono::system_clock::now();
+  for (int i = 0; i < N; i++) {
+    long long x, y;
+    s4 += binaryEEA(A[i], B[i], x, y);
+  }
+  double fastEEA = elapsed(start_time);
+  assert(s1 == s3 && s1 == s4);
+  cout << "Subtest 2 (gcd benchmark) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Time (gcd): " << fixed << setprecision(3) << slow << "s" << endl;
+  cout << "  Time (binaryGCD): " << fixed << setprecision(3) << fast << "s" << endl;
+  cout << "  Time (EEA): " << fixed << setprecision(3) << slowEEA << "s" << endl;
+  cout << "  Time (binaryEEA): " << fixed << setprecision(3) << fastEEA << "s" << endl;
+  cout << "  Checksum: " << s1 << endl;
+}
+
+void test3(int subtest, long long MOD) {
+  mt19937_64 rng(subtest);
+  const int N = 1e7;
+  vector<long long> A(N), B(N), C(N);
+  for (auto &&a : A) a = rng() % (MOD - 1) + 1;
+  auto start_time = chrono::system_clock::now();
+  for (int i = 0; i < N; i++) B[i] = mulInv(A[i], MOD);
+  double slow = elapsed(start_time);
+  start_time = chrono::system_clock::now();
+  for (int i = 0; i < N; i++) C[i] = binaryMulInv(A[i], MOD);
+  double binary = elapsed(start_time);
+  assert(B == C);
+  start_time = chrono::system_clock::now();
+  C = mulInvBatch(A, MOD);
+  double batch = elapsed(start_time);
+  assert(B == C);
+  A[N / 2] = 0;
+  C = mulInvBatch(A, MOD);
+  B[N / 2] = -1;
+  assert(B == C);
+  long long checkSum = 0;
+  for (int i = 0; i < N; i += 1000) checkSum = 31 * checkSum + C[i];
+  cout << "Subtest " << subtest << " (inverse benchmark) Passed" << endl;
+  cout << "  N: " << N << ", MOD: " << MOD << endl;
+  cout << "  Time (mulInv): " << fixed << setprecision(3) << slow << "s" << endl;
+  cout << "  Time (binaryMulInv): " << fixed << setprecision(3) << binary << "s" << endl;
+  cout << "  Time (mulInvBatch): " << fixed << setprecision(3) << batch << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test5() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(5);
+  const int TESTCASES = 1e5;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long m = rng() % 1000 + 1;
+    int N = rng() % 20;
+    vector<long long> A(N), expected(N);
+    for (int i = 0; i < N; i++) {
+      A[i] = rng() % m;
+      expected[i] = mulInv(A[i], m);
+    }
+    assert(mulInvBatch(A, m) == expected);
+    for (auto &&e : expected) checkSum = 31 * checkSum + e;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 5 (batch with small moduli) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3(3, 1e9 + 7);
+  test3(4, 998244353);
+  test5();
+  cout << "Test Passed" << endl;
+  return 0;
+}
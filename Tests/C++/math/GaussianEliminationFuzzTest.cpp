@@ -0,0 +1,116 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/GaussianElimination.h"
+using namespace std;
+
+using GE = GaussianEliminationMod<long long>;
+
+long long powMod(long long a, long long e, long long mod) {
+  long long ret = 1 % mod;
+  for (a %= mod; e > 0; e >>= 1, a = __int128_t(a) * a % mod) if (e & 1) ret = __int128_t(ret) * a % mod;
+  return ret;
+}
+
+// returns the rank of A and whether Ax = b has a solution, with a naive elimination
+pair<int, bool> naive(vector<vector<long long>> A, vector<long long> b, long long mod) {
+  int M = A.size(), N = M == 0 ? 0 : A[0].size(), r = 0;
+  for (int i = 0; i < M; i++) A[i].push_back(b[i]);
+  for (int c = 0; c < N && r < M; c++) {
+    int p = r;
+    while (p < M && A[p][c] == 0) p++;
+    if (p == M) continue;
+    swap(A[p], A[r]);
+    long long inv = powMod(A[r][c], mod - 2, mod);
+    for (int i = r + 1; i < M; i++) if (A[i][c] != 0) {
+      long long h = __int128_t(A[i][c]) * inv % mod;
+      for (int j = c; j <= N; j++) A[i][j] = ((A[i][j] - __int128_t(h) * A[r][j]) % mod + mod) % mod;
+    }
+    r++;
+  }
+  for (int i = r; i < M; i++) if (A[i][N] != 0) return make_pair(r, false);
+  return make_pair(r, true);
+}
+
+void checkProduct(const vector<vector<long long>> &A, const vector<long long> &y, const vector<long long> &b, long long mod) {
+  for (int i = 0; i < int(A.size()); i++) {
+    long long s = 0;
+    for (int j = 0; j < int(y.size()); j++) s = (s + __int128_t(A[i][j]) * y[j]) % mod;
+    assert(s == b[i]);
+  }
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  const long long MODS[] = {2, 3, 7, 998244353, 1000000007, 3037000493LL, 4294967291LL};
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long mod = MODS[rng() % 7];
+    int M = rng() % 40 + 1, N = rng() % 40 + 1, R = rng() % (min(M, N) + 1);
+    vector<vector<long long>> A(M, vector<long long>(N, 0));
+    if (rng() % 2 == 0) {
+      for (auto &&row : A) for (auto &&a : row) a = rng() % 3 == 0 ? rng() % mod : 0;
+    } else {
+      vector<vector<long long>> L(M, vector<long long>(R)), U(R, vector<long long>(N));
+      for (auto &&row : L) for (auto &&a : row) a = rng() % mod;
+      for (auto &&row : U) for (auto &&a : row) a = rng() % mod;
+      for (int i = 0; i < M; i++) for (int k = 0; k < R; k++) for (int j = 0; j < N; j++)
+        A[i][j] = (A[i][j] + __int128_t(L[i][k]) * U[k][j]) % mod;
+    }
+    vector<long long> b(M);
+    if (rng() % 2 == 0) for (auto &&bi : b) bi = rng() % mod;
+    else {
+      vector<long long> y(N);
+      for (auto &&yi : y) yi = rng() % mod;
+      for (int i = 0; i < M; i++) for (int j = 0; j < N; j++) b[i] = (b[i] + __int128_t(A[i][j]) * y[j]) % mod;
+    }
+    GE ge(A, b, mod);
+    pair<int, bool> expected = naive(A, b, mod);
+    assert(ge.rank == expected.first);
+    assert(int(ge.nullspace.size()) == N - ge.rank);
+    for (auto &&v : ge.nullspace) checkProduct(A, v, vector<long long>(M, 0), mod);
+    if (!expected.second) {
+      assert(ge.solutions == GE::NO_SOLUTION && ge.x.empty());
+    } else {
+      assert(ge.solutions == (ge.rank < N ? GE::INF_SOLUTIONS : GE::ONE_SOLUTION));
+      checkProduct(A, ge.x, b, mod);
+      for (auto &&xi : ge.x) checkSum = 31 * checkSum + xi;
+    }
+    checkSum = 31 * checkSum + ge.rank;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against naive elimination) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2(int subtest, long long mod, int N) {
+  mt19937_64 rng(subtest);
+  vector<vector<long long>> A(N, vector<long long>(N));
+  for (auto &&row : A) for (auto &&a : row) a = rng() % mod;
+  vector<long long> y(N), b(N, 0);
+  for (auto &&yi : y) yi = rng() % mod;
+  for (int i = 0; i < N; i++) for (int j = 0; j < N; j++) b[i] = (b[i] + __int128_t(A[i][j]) * y[j]) % mod;
+  const auto start_time = chrono::system_clock::now();
+  GE ge(A, b, mod);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(ge.solutions != GE::NO_SOLUTION);
+  checkProduct(A, ge.x, b, mod);
+  long long checkSum = 0;
+  for (auto &&xi : ge.x) checkSum = 31 * checkSum + xi;
+  cout << "Subtest " << subtest << " (large dense system) Passed" << endl;
+  cout << "  MOD: " << mod << ", N: " << N << ", K: " << ge.K << endl;
+  cout << "  Rank: " << ge.rank << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2(2, 998244353, 1500);
+  test2(3, 4294967291LL, 1500);
+  cout << "Test Passed" << endl;
+  return 0;
+}
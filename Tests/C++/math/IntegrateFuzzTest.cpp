@@ -0,0 +1,118 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/Integrate.h"
+using namespace std;
+
+const double PI = acos(-1.0);
+
+struct Case {
+  function<double(double)> f;
+  double a, b, expected;
+};
+
+// returns a random integrand with a known integral
+Case randomCase(mt19937_64 &rng) {
+  uniform_real_distribution<double> dist(-3, 3);
+  double a = dist(rng), b = dist(rng), p = dist(rng), q = dist(rng);
+  int type = rng() % 5;
+  if (type == 0) {
+    vector<double> c(rng() % 10 + 1);
+    for (auto &&ci : c) ci = dist(rng);
+    auto F = [=] (double x) {
+      double ret = 0;
+      for (int i = int(c.size()) - 1; i >= 0; i--) ret = ret * x + c[i] / (i + 1);
+      return ret * x;
+    };
+    return Case{[=] (double x) {
+      double ret = 0;
+      for (int i = int(c.size()) - 1; i >= 0; i--) ret = ret * x + c[i];
+      return ret;
+    }, a, b, F(b) - F(a)};
+  } else if (type == 1) {
+    return Case{[=] (double x) { return sin(p * x + q); }, a, b, p == 0 ? sin(q) * (b - a) : (cos(p * a + q) - cos(p * b + q)) / p};
+  } else if (type == 2) {
+    return Case{[=] (double x) { return exp(p * x); }, a, b, (exp(p * b) - exp(p * a)) / p};
+  } else if (type == 3) {
+    a = abs(a) - 3;
+    b = abs(b) - 3;
+    return Case{[=] (double x) { return sqrt(x + 3); }, a, b, (pow(b + 3, 1.5) - pow(a + 3, 1.5)) * 2 / 3};
+  } else {
+    double w = abs(p) / 100 + 1e-3;
+    return Case{[=] (double x) { return w / ((x - q) * (x - q) + w * w); }, a, b, atan((b - q) / w) - atan((a - q) / w)};
+  }
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  const double EPS = 1e-9;
+  long long checkSum = 0;
+  vector<function<double(double)>> fs;
+  vector<pair<double, double>> bounds;
+  vector<double> expected;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    Case c = randomCase(rng);
+    double v1 = integrateGaussKronrod(c.f, c.a, c.b, EPS);
+    double v2 = integrateGaussKronrod(c.f, c.a, c.b, EPS, 3);
+    assert(abs(v1 - c.expected) <= 1e-7);
+    assert(abs(v2 - c.expected) <= 1e-7);
+    fs.push_back(c.f);
+    bounds.emplace_back(c.a, c.b);
+    expected.push_back(v1);
+    checkSum = 31 * checkSum + (long long)(round(v1 * 1e6));
+  }
+  vector<double> batch = integrateBatch(fs, bounds, EPS, 4);
+  for (int i = 0; i < TESTCASES; i++) assert(batch[i] == expected[i]);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against known integrals, serial, parallel and batched) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const double EPS = 1e-9;
+  atomic<long long> evals(0);
+  // an expensive oscillatory integrand with an integrable singularity at 0
+  auto f = [&] (double x) {
+    evals++;
+    double ret = 0;
+    for (int k = 1; k <= 200; k++) ret += cos(k * x) / (k * k);
+    return ret + 1 / sqrt(abs(x));
+  };
+  double expected = 2 + 2 * sqrt(2.0);
+  for (int k = 1; k <= 200; k++) expected += (sin(2.0 * k) + sin(double(k))) / (double(k) * k * k);
+  vector<double> times;
+  vector<long long> counts;
+  for (int threads : {1, 2, 4}) {
+    evals = 0;
+    const auto start_time = chrono::system_clock::now();
+    double v = integrateGaussKronrod(f, -1.0, 2.0, EPS, threads);
+    const auto end_time = chrono::system_clock::now();
+    assert(abs(v - expected) <= 1e-7);
+    times.push_back((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    counts.push_back(evals);
+  }
+  evals = 0;
+  const auto start_time = chrono::system_clock::now();
+  double v = integrate(f, -1.0, 2.0, EPS);
+  const auto end_time = chrono::system_clock::now();
+  double simpson = (end_time - start_time).count() / double(chrono::system_clock::period::den);
+  cout << "Subtest 2 (expensive integrand with singularity) Passed" << endl;
+  cout << "  Evaluations (Gauss-Kronrod, 1 thread): " << counts[0] << endl;
+  cout << "  Evaluations (Gauss-Kronrod, 4 threads): " << counts[2] << endl;
+  cout << "  Evaluations (adaptive Simpson): " << evals << endl;
+  cout << "  Error (adaptive Simpson): " << scientific << setprecision(3) << abs(v - expected) << endl;
+  cout << "  Time (Gauss-Kronrod, 1 thread): " << fixed << setprecision(3) << times[0] << "s" << endl;
+  cout << "  Time (Gauss-Kronrod, 2 threads): " << fixed << setprecision(3) << times[1] << "s" << endl;
+  cout << "  Time (Gauss-Kronrod, 4 threads): " << fixed << setprecision(3) << times[2] << "s" << endl;
+  cout << "  Time (adaptive Simpson): " << fixed << setprecision(3) << simpson << "s" << endl;
+  cout << "  Checksum: " << (long long)(round(expected * 1e6)) << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/IntMod.h"
+#include "../../../Content/C++/math/LinearRecurrence.h"
+using namespace std;
+
+const long long MOD = 998244353;
+using IM = IntMod<long long, MOD, true>;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 60 + 1, Q = 10;
+    vector<long long> A(N), C(N);
+    for (auto &&a : A) a = rng() % MOD;
+    for (auto &&c : C) c = rng() % 3 == 0 ? 0 : rng() % MOD;
+    vector<IM> AM(A.begin(), A.end()), CM(C.begin(), C.end());
+    LinearRecurrenceNTT<long long, MOD> LR(A, C);
+    vector<long long> K(Q);
+    for (auto &&k : K) k = rng() % 3 == 0 ? rng() % (N * 3) : rng() % (1LL << (rng() % 62));
+    vector<long long> ans = LR.getAll(K);
+    for (int i = 0; i < Q; i++) {
+      assert(ans[i] == linearRecurrence(AM, CM, K[i]).v);
+      checkSum = 31 * checkSum + ans[i];
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  int N = 1e5, Q = 1;
+  vector<long long> A(N), C(N);
+  for (auto &&a : A) a = rng() % MOD;
+  for (auto &&c : C) c = rng() % MOD;
+  LinearRecurrenceNTT<long long, MOD> LR(A, C);
+  long long checkSum = 0;
+  for (int i = 0; i < Q; i++) checkSum = 31 * checkSum + LR.get(rng() % (long long)(1e18));
+  long long K = N + 5;
+  long long expected = 0;
+  vector<long long> B = A;
+  for (long long k = N; k <= K; k++) {
+    long long v = 0;
+    for (int j = 0; j < N; j++) v = (v + C[j] * B[k - 1 - j]) % MOD;
+    B.push_back(v);
+  }
+  expected = B[K];
+  assert(LR.get(K) == expected);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
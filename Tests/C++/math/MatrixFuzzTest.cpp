@@ -1,5 +1,6 @@
 #include <bits/stdc++.h>
 #include "../../../Content/C++/math/Matrix.h"
+#include "../../../Content/C++/math/ModularArithmetic.h"
 using namespace std;
 
 void test1() {
@@ -27,8 +28,110 @@ void test1() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+Matrix<long long> naiveMul(const Matrix<long long> &A, const Matrix<long long> &B, long long mod) {
+  Matrix<long long> C = makeMatrix<long long>(getN(A), getM(B));
+  for (int i = 0; i < getN(A); i++) for (int j = 0; j < getM(B); j++) for (int k = 0; k < getM(A); k++)
+    C[i][j] = mod == 0 ? C[i][j] + A[i][k] * B[k][j] : addMod(C[i][j], (long long)(__int128_t(A[i][k]) * B[k][j] % mod), mod);
+  return C;
+}
+
+Matrix<long long> randomMatrix(mt19937_64 &rng, int N, int M, long long mod) {
+  Matrix<long long> A = makeMatrix<long long>(N, M);
+  for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) A[i][j] = rng() % 4 == 0 ? mod - 1 : rng() % mod;
+  return A;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 300;
+  const long long MODS[] = {1, 2, 1000, (long long)(1e9) + 7, (1LL << 31) - 1, 1LL << 31, (long long)(1e18) + 9, (1LL << 61) - 1};
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 70 + 1, K = rng() % 300 + 1, M = rng() % 600 + 1;
+    if (ti % 3 == 0) K = rng() % 5 + 1;
+    Matrix<long long> A = randomMatrix(rng, N, K, 1000), B = randomMatrix(rng, K, M, 1000);
+    Matrix<long long> C = A * B;
+    assert(C == naiveMul(A, B, 0));
+    long long mod = MODS[rng() % 8];
+    A = randomMatrix(rng, N, K, mod);
+    B = randomMatrix(rng, K, M, mod);
+    Matrix<long long> D = mulMatMod(A, B, mod);
+    assert(D == naiveMul(A, B, mod));
+    for (auto &&x : C.a) checkSum = 31 * checkSum + x;
+    for (auto &&x : D.a) checkSum = 31 * checkSum + x;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (mulMat, mulMatMod) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(2);
+  const int TESTCASES = 200;
+  const long long MOD = 1e9 + 7;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 12 + 1;
+    long long pow = rng() % 4 == 0 ? rng() % 10 : rng() % (long long)(1e18);
+    Matrix<long long> A = randomMatrix(rng, N, N, MOD);
+    Matrix<long long> P = powMatMod(A, pow, MOD);
+    if (pow < 10) {
+      Matrix<long long> Q = identityMatrix<long long>(N);
+      for (int i = 0; i < pow; i++) Q = naiveMul(Q, A, MOD);
+      assert(P == Q);
+    } else {
+      assert(naiveMul(P, A, MOD) == powMatMod(A, pow + 1, MOD));
+    }
+    Matrix<double> D = makeMatrix<double>(N, N);
+    for (int i = 0; i < N; i++) for (int j = 0; j < N; j++) D[i][j] = A[i][j] % 10;
+    double d = det(D), e = det(transpose(D) * identityMatrix<double>(N));
+    assert(abs(d - e) <= 1e-6 * max(1.0, abs(d)));
+    for (auto &&x : P.a) checkSum = 31 * checkSum + x;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (powMatMod, det) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  mt19937_64 rng(3);
+  const int N = 1024, THREADS = 4;
+  const long long MOD = 998244353;
+  Matrix<long long> A = randomMatrix(rng, N, N, MOD), B = randomMatrix(rng, N, N, MOD);
+  const auto start_time = chrono::system_clock::now();
+  Matrix<long long> C = mulMatMod(A, B, MOD);
+  const auto mid_time = chrono::system_clock::now();
+  Matrix<long long> D = mulMatMod(A, B, MOD, THREADS);
+  const auto end_time = chrono::system_clock::now();
+  assert(C == D);
+  for (int t = 0; t < 100; t++) {
+    int i = rng() % N, j = rng() % N;
+    long long v = 0;
+    for (int k = 0; k < N; k++) v = (v + A[i][k] * B[k][j]) % MOD;
+    assert(C[i][j] == v);
+  }
+  long long checkSum = 0;
+  for (auto &&x : C.a) checkSum = 31 * checkSum + x;
+  double sec1 = ((mid_time - start_time).count() / double(chrono::system_clock::period::den));
+  double sec2 = ((end_time - mid_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (large mulMatMod) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Time (1 thread): " << fixed << setprecision(3) << sec1 << "s" << endl;
+  cout << "  Time (" << THREADS << " threads): " << fixed << setprecision(3) << sec2 << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
+  test2();
+  test3();
+  test4();
   cout << "Test Passed" << endl;
   return 0;
 }
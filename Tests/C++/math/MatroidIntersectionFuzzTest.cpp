@@ -0,0 +1,142 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/MatroidIntersection.h"
+#include "../../../Content/C++/graph/matching/HungarianAlgorithm.h"
+using namespace std;
+
+template <class Matroid> bool independentSubset(Matroid m, int N, int mask) {
+  m.clear();
+  for (int i = 0; i < N; i++) if (mask >> i & 1) {
+    if (!m.independent(i)) return false;
+    m.add(i);
+  }
+  return true;
+}
+
+template <class Matroid1, class Matroid2>
+long long check(mt19937_64 &rng, int N, const Matroid1 &m1, const Matroid2 &m2) {
+  vector<long long> w(N);
+  for (auto &&wi : w) wi = rng() % 3 == 0 ? -(long long)(rng() % 20) : (long long)(rng() % 100);
+  vector<long long> best(N + 1, LLONG_MIN);
+  for (int mask = 0; mask < (1 << N); mask++) if (independentSubset(m1, N, mask) && independentSubset(m2, N, mask)) {
+    long long s = 0;
+    for (int i = 0; i < N; i++) if (mask >> i & 1) s += w[i];
+    int k = __builtin_popcount(mask);
+    best[k] = max(best[k], s);
+  }
+  int R = N;
+  while (best[R] == LLONG_MIN) R--;
+  MatroidIntersection<Matroid1, Matroid2> mi(N, m1, m2);
+  assert(int(mi.independentSet.size()) == R);
+  WeightedMatroidIntersection<Matroid1, Matroid2, long long> wmi(N, m1, m2, w, true);
+  assert(int(wmi.maxWeight.size()) == R + 1);
+  for (int k = 0; k <= R; k++) assert(wmi.maxWeight[k] == best[k]);
+  int mask = 0;
+  long long s = 0;
+  for (int i : wmi.independentSet) {
+    mask |= 1 << i;
+    s += w[i];
+  }
+  assert(s == wmi.weight && wmi.weight == best[R]);
+  assert(independentSubset(m1, N, mask) && independentSubset(m2, N, mask));
+  WeightedMatroidIntersection<Matroid1, Matroid2, long long> wmi2(N, m1, m2, w, false);
+  long long mx = *max_element(best.begin(), best.end());
+  mask = 0;
+  s = 0;
+  for (int i : wmi2.independentSet) {
+    mask |= 1 << i;
+    s += w[i];
+  }
+  assert(s == wmi2.weight && wmi2.weight == mx);
+  assert(independentSubset(m1, N, mask) && independentSubset(m2, N, mask));
+  return wmi.weight * 31 + wmi2.weight;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 12 + 1, V = rng() % 6 + 1, C = rng() % 6 + 1;
+    vector<pair<int, int>> edges;
+    vector<int> color;
+    vector<bitset<5>> vec;
+    for (int i = 0; i < N; i++) {
+      edges.emplace_back(rng() % V, rng() % V);
+      color.push_back(rng() % C);
+      vec.emplace_back(rng() % 32);
+    }
+    GraphicMatroid g(V, edges);
+    ColorfulMatroid c(color);
+    Z2Matroid<5> z(vec);
+    if (ti % 3 == 0) checkSum = 31 * checkSum + check(rng, N, g, c);
+    else if (ti % 3 == 1) checkSum = 31 * checkSum + check(rng, N, z, c);
+    else checkSum = 31 * checkSum + check(rng, N, g, z);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against brute force) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 20;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int L = rng() % 40 + 1, R = rng() % 40 + 1;
+    vector<int> left, right;
+    vector<long long> w;
+    vector<vector<long long>> A(L, vector<long long>(R, 0));
+    for (int i = 0; i < L; i++) for (int j = 0; j < R; j++) {
+      left.push_back(i);
+      right.push_back(j);
+      w.push_back(rng() % 1000);
+      A[i][j] = -w.back();
+    }
+    HungarianAlgorithm<long long> h(A);
+    WeightedMatroidIntersection<ColorfulMatroid, ColorfulMatroid, long long> wmi(L * R, ColorfulMatroid(left), ColorfulMatroid(right), w, true);
+    assert(int(wmi.independentSet.size()) == min(L, R) && wmi.weight == -h.cost);
+    checkSum = 31 * checkSum + wmi.weight;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (assignment against hungarian) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(2);
+  const int V = 300, N = 3000, C = 200;
+  vector<pair<int, int>> edges;
+  vector<int> color;
+  vector<long long> w;
+  for (int i = 0; i < N; i++) {
+    edges.emplace_back(rng() % V, rng() % V);
+    color.push_back(rng() % C);
+    w.push_back(rng() % 1000000);
+  }
+  MatroidIntersection<GraphicMatroid, ColorfulMatroid> mi(N, GraphicMatroid(V, edges), ColorfulMatroid(color));
+  WeightedMatroidIntersection<GraphicMatroid, ColorfulMatroid, long long> wmi(N, GraphicMatroid(V, edges), ColorfulMatroid(color), w, true);
+  assert(wmi.independentSet.size() == mi.independentSet.size());
+  for (int k = 2; k < int(wmi.maxWeight.size()); k++)
+    assert(wmi.maxWeight[k] - wmi.maxWeight[k - 1] <= wmi.maxWeight[k - 1] - wmi.maxWeight[k - 2]);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (large graphic and colorful) Passed" << endl;
+  cout << "  N: " << N << ", size: " << wmi.independentSet.size() << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << wmi.weight << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
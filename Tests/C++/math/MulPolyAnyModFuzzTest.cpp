@@ -0,0 +1,44 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/NTT.h"
+using namespace std;
+
+template <const long long MOD> vector<long long> naiveMul(const vector<long long> &A, const vector<long long> &B) {
+  vector<long long> C(A.size() + B.size() - 1, 0);
+  for (int i = 0; i < int(A.size()); i++) for (int j = 0; j < int(B.size()); j++)
+    C[i + j] = addMod(C[i + j], mulMod(A[i], B[j], MOD), MOD);
+  while (int(C.size()) > 1 && C.back() == 0) C.pop_back();
+  return C;
+}
+
+template <const long long MOD> void test(int subtest, int TESTCASES, int MAXN) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % MAXN + 1, M = rng() % MAXN + 1;
+    bool eq = rng() % 4 == 0;
+    if (eq) M = N;
+    vector<long long> A(N), B(M);
+    for (auto &&ai : A) ai = rng() % 2 == 0 ? MOD - 1 : rng() % MOD;
+    for (auto &&bi : B) bi = rng() % 2 == 0 ? MOD - 1 : rng() % MOD;
+    if (eq) B = A;
+    vector<long long> C = mulPolyAnyMod<long long, MOD>(A, B, eq);
+    assert(C == naiveMul<MOD>(A, B));
+    for (auto &&c : C) checkSum = 31 * checkSum + c;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (MOD = " << MOD << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<1000000007>(1, 200, 3000);
+  test<998244353>(2, 200, 3000);
+  test<(1LL << 31) - 1>(3, 200, 3000);
+  test<2>(4, 200, 3000);
+  test<3000000019>(5, 200, 3000);
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/NTT.h"
+using namespace std;
+
+const long long MOD = 998244353;
+
+void test1() {
+  mt19937_64 rng(0);
+  for (int lg = 10; lg <= 23; lg++) {
+    int N = 1 << lg;
+    vector<long long> A(N);
+    for (auto &&ai : A) ai = rng() % MOD;
+    const auto start_time = chrono::system_clock::now();
+    ntt<long long, MOD>(A);
+    const auto end_time = chrono::system_clock::now();
+    double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    cout << "Subtest 1 (ntt) Passed" << endl;
+    cout << "  N: " << N << endl;
+    cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+    long long checkSum = 0;
+    for (auto &&a : A) checkSum = 31 * checkSum + a;
+    cout << "  Checksum: " << checkSum << endl;
+  }
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  NTTMontgomery<MOD> E;
+  for (int lg = 10; lg <= 23; lg++) {
+    int N = 1 << lg;
+    vector<uint32_t> A(N);
+    for (auto &&ai : A) ai = rng() % MOD;
+    const auto start_time = chrono::system_clock::now();
+    E.forward(A);
+    const auto end_time = chrono::system_clock::now();
+    double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    cout << "Subtest 2 (NTTMontgomery) Passed" << endl;
+    cout << "  N: " << N << endl;
+    cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+    long long checkSum = 0;
+    for (auto &&a : A) checkSum = 31 * checkSum + a % MOD;
+    cout << "  Checksum: " << checkSum << endl;
+  }
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 50;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % (1 << (rng() % 20)) + 1, M = rng() % (1 << (rng() % 20)) + 1;
+    bool eq = rng() % 4 == 0;
+    if (eq) M = N;
+    vector<long long> A(N), B(M);
+    for (auto &&ai : A) ai = rng() % 2 == 0 ? MOD - 1 : rng() % MOD;
+    for (auto &&bi : B) bi = rng() % 2 == 0 ? MOD - 1 : rng() % MOD;
+    if (eq) B = A;
+    int K = N + M - 1;
+    while (K & (K - 1)) K++;
+    vector<long long> C = cyclicConvNTT<long long, MOD>(A, B, K, eq, false_type());
+    while (int(C.size()) > 1 && C.back() == 0) C.pop_back();
+    vector<long long> D = mulPolyNTT<long long, MOD>(A, B, eq);
+    assert(C == D);
+    for (auto &&d : D) checkSum = 31 * checkSum + d;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (mulPolyNTT) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/Nimber.h"
+using namespace std;
+
+uint64_t randomValue(mt19937_64 &rng) {
+  switch (rng() % 4) {
+    case 0: return rng() >> (rng() % 64);
+    case 1: return uint64_t(1) << (rng() % 64);
+    default: return rng();
+  }
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e5;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    uint64_t a = randomValue(rng), b = randomValue(rng), c = mulNim64(a, b);
+    assert(c == mulNim(a, b));
+    uint32_t a32 = a, b32 = b;
+    assert(mulNim64(a32, b32) == mulNim(a32, b32));
+    checkSum = 31 * checkSum + c;
+  }
+  for (uint64_t a = 0; a < 256; a++) for (uint64_t b = 0; b < 256; b++)
+    assert(mulNim64(a, b) == mulNim(uint8_t(a), uint8_t(b)));
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against mulNim) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+double elapsed(chrono::system_clock::time_point start_time) {
+  return (chrono::system_clock::now() - start_time).count() / double(chrono::system_clock::period::den);
+}
+
+void test2() {
+  mt19937_64 rng(1);
+  const int N = 1 << 12, ROUNDS = 200, SLOW_ROUNDS = 2;
+  vector<uint64_t> A(N), B(N);
+  for (auto &&a : A) a = rng();
+  for (auto &&b : B) b = rng();
+  vector<uint64_t> C = A, D = A, E = A, F = A;
+  uint64_t s = rng();
+  auto start_time = chrono::system_clock::now();
+  for (int r = 0; r < SLOW_ROUNDS; r++) for (int i = 0; i < N; i++) C[i] = mulNim(C[i], B[i]);
+  double slow = elapsed(start_time) * ROUNDS / SLOW_ROUNDS;
+  start_time = chrono::system_clock::now();
+  for (int r = 0; r < ROUNDS; r++) for (int i = 0; i < N; i++) D[i] = mulNim64(D[i], B[i]);
+  double fast = elapsed(start_time);
+  start_time = chrono::system_clock::now();
+  for (int r = 0; r < ROUNDS; r++) mulNim64(E.data(), B.data(), E.data(), N);
+  double batch = elapsed(start_time);
+  start_time = chrono::system_clock::now();
+  for (int r = 0; r < ROUNDS; r++) mulNim64(F.data(), s, F.data(), N);
+  double scalar = elapsed(start_time);
+  vector<uint64_t> G = A;
+  for (int r = 0; r < SLOW_ROUNDS; r++) for (int i = 0; i < N; i++) G[i] = mulNim64(G[i], B[i]);
+  assert(C == G && D == E);
+  uint64_t p = 1;
+  for (int r = 0; r < ROUNDS; r++) p = mulNim(p, s);
+  for (int i = 0; i < N; i++) assert(F[i] == mulNim(A[i], p));
+  long long checkSum = 0;
+  for (int i = 0; i < N; i++) checkSum = 31 * checkSum + (E[i] ^ F[i]);
+  cout << "Subtest 2 (benchmark) Passed" << endl;
+  cout << "  Products: " << N * ROUNDS << endl;
+  cout << "  Time (mulNim, extrapolated): " << fixed << setprecision(3) << slow << "s" << endl;
+  cout << "  Time (mulNim64): " << fixed << setprecision(3) << fast << "s" << endl;
+  cout << "  Time (mulNim64 batch): " << fixed << setprecision(3) << batch << "s" << endl;
+  cout << "  Time (mulNim64 batch by scalar): " << fixed << setprecision(3) << scalar << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,262 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/Primes.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int N = 2e6, TESTCASES = 2000;
+  Sieve sieve(N);
+  vector<int> pi(N + 1, 0);
+  for (int i = 1; i <= N; i++) pi[i] = pi[i - 1] + sieve.isPrime(i);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int lo = rng() % 2 == 0 ? rng() % 100 : rng() % (N + 1), hi = rng() % 3 == 0 ? lo + rng() % 100 : rng() % (N + 1);
+    if (lo > hi) swap(lo, hi);
+    vector<long long> A, B;
+    for (int i = lo; i <= hi; i++) if (sieve.isPrime(i)) A.push_back(i);
+    wheelSieve(lo, hi, [&] (long long p) { B.push_back(p); });
+    assert(A == B);
+    assert(wheelSieveCount(lo, hi) == (long long)(A.size()));
+    assert(primePi(hi) == pi[hi]);
+    checkSum = 31 * checkSum + A.size();
+  }
+  for (int i = 0; i <= 20000; i++) assert(primePi(i) == pi[i]);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (small ranges) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long hi = rng() % (long long)(1e13) + 1;
+    if (ti % 4 == 0) hi = (long long)(rng() % 100000) * (rng() % 100000) + 1;
+    long long lo = max(0LL, hi - (long long)(rng() % 3000000));
+    vector<long long> A, B;
+    segmentedSieve(lo, hi, [&] (long long p) { A.push_back(p); });
+    wheelSieve(lo, hi, [&] (long long p) { B.push_back(p); });
+    assert(A == B);
+    long long cnt = wheelSieveCount(lo, hi, ti % 4 + 1);
+    assert(cnt == (long long)(A.size()));
+    if (hi <= 1e9) assert(primePi(hi) - primePi(lo - 1) == cnt);
+    checkSum = 31 * checkSum + cnt;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (large ranges against segmentedSieve) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(2);
+  const int TESTCASES = 40;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long N = rng() % (long long)(3e8) + 1;
+    int threads = ti % 4 + 1;
+    long long cnt = wheelSieveCount(0, N, threads), pi = primePi(N);
+    assert(cnt == pi);
+    vector<long long> cnts(threads, 0);
+    mutex mtx;
+    long long last = 0, total = 0;
+    wheelSieve(N / 2, N, [&] (long long p) {
+      lock_guard<mutex> lock(mtx);
+      total++;
+      last = max(last, p);
+    }, threads);
+    assert(total == pi - primePi(N / 2 - 1));
+    checkSum = 31 * checkSum + pi + last;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (multithreaded against primePi) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  const vector<pair<long long, long long>> known = {
+    {10000000000LL, 455052511LL}, {100000000000LL, 4118054813LL},
+    {1000000000000LL, 37607912018LL}, {10000000000000LL, 346065536839LL},
+    {100000000000000LL, 3204941750802LL}, {1000000000000000LL, 29844570422669LL}
+  };
+  for (int i = 0; i < 4; i++) {
+    const auto start_time = chrono::system_clock::now();
+    long long pi = primePi(known[i].first);
+    const auto end_time = chrono::system_clock::now();
+    double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+    assert(pi == known[i].second);
+    cout << "Subtest 4." << i + 1 << " (primePi) Passed" << endl;
+    cout << "  N: " << known[i].first << endl;
+    cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+    cout << "  Checksum: " << pi << endl;
+  }
+  const auto start_time = chrono::system_clock::now();
+  long long cnt = wheelSieveCount(0, known[0].first, 4);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  assert(cnt == known[0].second);
+  cout << "Subtest 4.5 (wheelSieveCount) Passed" << endl;
+  cout << "  N: " << known[0].first << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << cnt << endl;
+}
+
+void test5() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(4);
+  const int N = 2e6, TESTCASES = 1e6;
+  Sieve sieve(N);
+  long long checkSum = 0;
+  for (int i = 0; i <= N; i++) {
+    assert(millerRabin64(i) == sieve.isPrime(i));
+    checkSum = 31 * checkSum + millerRabin64(i);
+  }
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    uint64_t mod = rng() | 1, a = rng() % mod, b = rng() % mod;
+    if (ti % 3 == 0) mod >>= rng() % 63 + 1;
+    mod |= 1;
+    a %= mod;
+    b %= mod;
+    Montgomery64 M(mod);
+    uint64_t c = M.reduce(M.mul(M.init(a), M.init(b)));
+    assert(c == uint64_t(__uint128_t(a) * b % mod));
+    assert(M.reduce(M.add(M.init(a), M.init(b))) == uint64_t((__uint128_t(a) + b) % mod));
+    assert(M.reduce(M.sub(M.init(a), M.init(b))) == (a >= b ? a - b : a + (mod - b)));
+    uint64_t x = rng();
+    bool p = millerRabin64(x);
+    if (x < (1ULL << 62) - 1) assert(p == millerRabin(__int128_t(x)));
+    checkSum = 31 * checkSum + c + p;
+  }
+  const vector<uint64_t> pseudoprimes = {
+    3215031751ULL, 2152302898747ULL, 3474749660383ULL, 341550071728321ULL, 3825123056546413051ULL,
+    4759123141ULL, 1122004669633ULL
+  };
+  for (auto &&x : pseudoprimes) assert(!millerRabin64(x));
+  const vector<uint64_t> primes = {
+    2305843009213693951ULL, 18446744073709551557ULL, 4611686018427387847ULL, 1000000000000000003ULL, 998244353ULL
+  };
+  for (auto &&x : primes) assert(millerRabin64(x));
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 5 (Montgomery64 and millerRabin64) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+uint64_t randomPrime(mt19937_64 &rng, int bits) {
+  while (true) {
+    uint64_t x = (rng() >> (64 - bits)) | (1ULL << (bits - 1)) | 1;
+    if (millerRabin64(x)) return x;
+  }
+}
+
+void test6() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(5);
+  const int TESTCASES = 20000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    uint64_t x;
+    int type = ti % 4;
+    if (type == 0) x = rng() >> (rng() % 64);
+    else if (type == 1) {
+      int bits = rng() % 31 + 2;
+      x = randomPrime(rng, bits) * randomPrime(rng, 64 - bits);
+    } else if (type == 2) {
+      uint64_t p = randomPrime(rng, rng() % 21 + 2);
+      x = 1;
+      while (x <= UINT64_MAX / p) x *= p;
+      if (rng() % 2 == 0) x /= p;
+    } else {
+      x = 1;
+      for (int k = 0; k < 8; k++) {
+        uint64_t p = randomPrime(rng, rng() % 16 + 2);
+        if (x <= UINT64_MAX / p) x *= p;
+      }
+    }
+    vector<uint64_t> f = primeFactor64(x);
+    uint64_t prod = 1;
+    for (auto &&p : f) {
+      assert(millerRabin64(p));
+      prod *= p;
+    }
+    assert(is_sorted(f.begin(), f.end()));
+    assert(x == 0 ? f.empty() : prod == x);
+    if (x > 1) {
+      uint64_t d = f.size() > 1 ? pollardsRhoBrent(x) : x;
+      assert(d > 1 && x % d == 0 && (f.size() == 1 || d < x));
+    }
+    if (x < 3e9 && x > 0) {
+      vector<long long> g = pollardsRhoPrimeFactor((long long)(x));
+      sort(g.begin(), g.end());
+      assert(vector<uint64_t>(g.begin(), g.end()) == f);
+    }
+    for (auto &&p : f) checkSum = 31 * checkSum + p;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 6 (primeFactor64) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test7() {
+  mt19937_64 rng(6);
+  const int N = 2e5, SMALL_N = 2e4;
+  vector<uint64_t> A(N), B(SMALL_N);
+  for (int i = 0; i < N; i++) A[i] = rng() >> 2;
+  for (int i = 0; i < SMALL_N; i++) B[i] = randomPrime(rng, 16) * randomPrime(rng, 16);
+  auto start_time = chrono::system_clock::now();
+  vector<vector<uint64_t>> F = factorAll(A, 4);
+  auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  long long checkSum = 0;
+  for (int i = 0; i < N; i++) {
+    uint64_t prod = 1;
+    for (auto &&p : F[i]) {
+      prod *= p;
+      checkSum = 31 * checkSum + p;
+    }
+    assert(prod == A[i]);
+  }
+  start_time = chrono::system_clock::now();
+  vector<vector<uint64_t>> G(SMALL_N);
+  for (int i = 0; i < SMALL_N; i++) G[i] = primeFactor64(B[i]);
+  end_time = chrono::system_clock::now();
+  double small = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  for (int i = 0; i < SMALL_N; i++) {
+    vector<long long> g = pollardsRhoPrimeFactor((long long)(B[i]));
+    sort(g.begin(), g.end());
+    assert(vector<uint64_t>(g.begin(), g.end()) == G[i]);
+  }
+  end_time = chrono::system_clock::now();
+  double slow = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 7 (factorAll) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Time (factorAll, random 62-bit): " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Time (primeFactor64, 32-bit semiprimes): " << fixed << setprecision(3) << small << "s" << endl;
+  cout << "  Time (pollardsRhoPrimeFactor, 32-bit semiprimes): " << fixed << setprecision(3) << slow << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  test5();
+  test6();
+  test7();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,158 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/Simplex.h"
+using namespace std;
+
+using Vec = RevisedSimplex<double>::Vec;
+const double INF = numeric_limits<double>::infinity();
+
+struct LP {
+  int M, N;
+  vector<Vec> A;
+  vector<double> b, c, ub;
+};
+
+LP randomLP(mt19937_64 &rng, int M, int N, bool packing) {
+  LP lp;
+  lp.M = M;
+  lp.N = N;
+  lp.A.resize(M);
+  int density = rng() % 80 + 10;
+  for (int i = 0; i < M; i++) for (int j = 0; j < N; j++) if (int(rng() % 100) < density) {
+    double v = packing ? double(rng() % 5 + 1) : double(int(rng() % 11) - 5);
+    if (v != 0) lp.A[i].emplace_back(j, v);
+  }
+  for (int i = 0; i < M; i++) lp.b.push_back(packing ? double(rng() % 20 + 1) : double(int(rng() % 31) - 10));
+  for (int j = 0; j < N; j++) lp.c.push_back(double(int(rng() % 11) - 5));
+  for (int j = 0; j < N; j++) lp.ub.push_back(rng() % 2 == 0 ? INF : double(rng() % 6));
+  return lp;
+}
+
+double denseSolve(const LP &lp, vector<double> &x) {
+  vector<vector<double>> A;
+  vector<double> b;
+  for (int i = 0; i < lp.M; i++) {
+    A.emplace_back(lp.N, 0.0);
+    for (auto &&e : lp.A[i]) A.back()[e.first] += e.second;
+    b.push_back(lp.b[i]);
+  }
+  for (int j = 0; j < lp.N; j++) if (lp.ub[j] < INF) {
+    A.emplace_back(lp.N, 0.0);
+    A.back()[j] = 1;
+    b.push_back(lp.ub[j]);
+  }
+  Simplex<double> s(A, b, lp.c);
+  x = s.x;
+  return s.val;
+}
+
+void checkSolution(const LP &lp, const RevisedSimplex<double> &s) {
+  if (abs(s.val) == INF && s.val < 0) return;
+  assert(int(s.x.size()) == lp.N);
+  double val = 0;
+  for (int j = 0; j < lp.N; j++) {
+    assert(s.x[j] >= -1e-6 && s.x[j] <= lp.ub[j] + 1e-6);
+    val += lp.c[j] * s.x[j];
+  }
+  for (int i = 0; i < lp.M; i++) {
+    double v = 0;
+    for (auto &&e : lp.A[i]) v += e.second * s.x[e.first];
+    assert(v <= lp.b[i] + 1e-6);
+  }
+  if (s.val < INF) assert(abs(val - s.val) <= 1e-6 * max(1.0, abs(val)));
+}
+
+bool same(double a, double b) {
+  if (abs(a) == INF || abs(b) == INF) return a == b;
+  return abs(a - b) <= 1e-6 * max(1.0, abs(a));
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int M = rng() % 30 + 1, N = rng() % 30 + 1;
+    LP lp = randomLP(rng, M, N, ti % 4 == 0);
+    vector<double> x;
+    double val = denseSolve(lp, x);
+    RevisedSimplex<double> s(lp.A, lp.b, lp.c, lp.ub);
+    assert(same(val, s.val));
+    checkSolution(lp, s);
+    for (int k = 0; k < 5; k++) {
+      if (rng() % 2 == 0) for (int j = 0; j < N; j++) {
+        if (rng() % 4 == 0) lp.c[j] = double(int(rng() % 11) - 5);
+      } else for (int i = 0; i < M; i++) {
+        if (rng() % 4 == 0) lp.b[i] = double(int(rng() % 31) - 10);
+      }
+      s.c = lp.c;
+      s.b = lp.b;
+      s.solve();
+      val = denseSolve(lp, x);
+      assert(same(val, s.val));
+      checkSolution(lp, s);
+    }
+    checkSum = 31 * checkSum + (abs(val) == INF ? (val > 0 ? 1 : 2) : (long long)(round(val * 1000)));
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against dense simplex, with warm starts) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int M = 5000, N = 5000, K = 3, CHANGES = 10;
+  LP lp;
+  lp.M = M;
+  lp.N = N;
+  lp.A.resize(M);
+  for (int i = 0; i < M; i++) {
+    lp.A[i].emplace_back(i % N, double(rng() % 9 + 1));
+    for (int k = 1; k < K; k++) lp.A[i].emplace_back(rng() % N, double(rng() % 9 + 1));
+  }
+  for (int i = 0; i < M; i++) lp.b.push_back(double(rng() % 100 + 1));
+  for (int j = 0; j < N; j++) lp.c.push_back(double(rng() % 100 + 1));
+  lp.ub.assign(N, INF);
+  RevisedSimplex<double> s(lp.A, lp.b, lp.c);
+  checkSolution(lp, s);
+  long long coldIters = s.iters;
+  const auto warm_start_time = chrono::system_clock::now();
+  for (int k = 0; k < CHANGES; k++) {
+    int j = rng() % N;
+    s.c[j] = lp.c[j] = double(rng() % 100 + 1);
+  }
+  s.solve();
+  checkSolution(lp, s);
+  long long warmCIters = s.iters;
+  for (int k = 0; k < CHANGES; k++) {
+    int i = rng() % M;
+    s.b[i] = lp.b[i] = double(rng() % 100 + 1);
+  }
+  s.solve();
+  checkSolution(lp, s);
+  long long warmBIters = s.iters;
+  const auto warm_end_time = chrono::system_clock::now();
+  RevisedSimplex<double> t(lp.A, lp.b, lp.c);
+  assert(same(s.val, t.val));
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  double warmSec = ((warm_end_time - warm_start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (large sparse warm start) Passed" << endl;
+  cout << "  M: " << M << ", N: " << N << endl;
+  cout << "  Iterations (cold): " << coldIters << endl;
+  cout << "  Iterations (warm, c changed): " << warmCIters << endl;
+  cout << "  Iterations (warm, b changed): " << warmBIters << endl;
+  cout << "  Time (warm): " << fixed << setprecision(3) << warmSec << "s" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << (long long)(round(t.val)) << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
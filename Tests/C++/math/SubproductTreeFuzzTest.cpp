@@ -0,0 +1,94 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/SubproductTree.h"
+using namespace std;
+
+const long long MOD = 998244353;
+
+long long naiveEval(const vector<long long> &P, long long x) {
+  long long v = 0;
+  for (int i = int(P.size()) - 1; i >= 0; i--) v = (v * x + P[i]) % MOD;
+  return v;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 1000, M = rng() % 1500;
+    vector<long long> X(N), P(M);
+    for (auto &&x : X) x = rng() % 4 == 0 ? rng() % 10 : rng() % MOD;
+    for (auto &&p : P) p = rng() % MOD;
+    SubproductTree<long long, MOD> tree(X);
+    for (int k = 0; k < 2; k++) {
+      vector<long long> Y = tree.evaluate(P);
+      assert(int(Y.size()) == N);
+      for (int i = 0; i < N; i++) assert(Y[i] == naiveEval(P, X[i]));
+      for (auto &&y : Y) checkSum = 31 * checkSum + y;
+      for (auto &&p : P) p = rng() % MOD;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (evaluate) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 1000;
+    set<long long> S;
+    while (int(S.size()) < N) S.insert(rng() % 2 == 0 ? rng() % (N * 2 + 1) : rng() % MOD);
+    vector<long long> X(S.begin(), S.end()), Y(N);
+    shuffle(X.begin(), X.end(), rng);
+    for (auto &&y : Y) y = rng() % MOD;
+    SubproductTree<long long, MOD> tree(X);
+    vector<long long> P = tree.interpolate(Y);
+    assert(int(P.size()) == N);
+    for (int i = 0; i < N; i++) assert(naiveEval(P, X[i]) == Y[i]);
+    for (auto &&p : P) checkSum = 31 * checkSum + p;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (interpolate) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(2);
+  int N = 1e5;
+  vector<long long> X(N), Y(N);
+  for (int i = 0; i < N; i++) X[i] = i * 7 + 3;
+  for (auto &&y : Y) y = rng() % MOD;
+  SubproductTree<long long, MOD> tree(X);
+  vector<long long> P = tree.interpolate(Y);
+  assert(tree.evaluate(P) == Y);
+  for (int i = 0; i < 100; i++) {
+    int j = rng() % N;
+    assert(naiveEval(P, X[j]) == Y[j]);
+  }
+  long long checkSum = 0;
+  for (auto &&p : P) checkSum = 31 * checkSum + p;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (large) Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
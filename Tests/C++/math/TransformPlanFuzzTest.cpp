@@ -0,0 +1,93 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/FFT.h"
+#include "../../../Content/C++/math/NTT.h"
+using namespace std;
+
+const long long MOD = 998244353;
+
+vector<long long> naiveMul(const vector<long long> &A, const vector<long long> &B, long long mod) {
+  vector<long long> C(A.size() + B.size() - 1, 0);
+  for (int i = 0; i < int(A.size()); i++) for (int j = 0; j < int(B.size()); j++) {
+    C[i + j] += A[i] * B[j];
+    if (mod != 0) C[i + j] %= mod;
+  }
+  while (int(C.size()) > 1 && C.back() == 0) C.pop_back();
+  return C;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  const int THREADS = 4, TESTCASES = 100;
+  FFTPlan<long double> plan(1 << 12);
+  vector<long long> checkSums(THREADS, 0);
+  vector<thread> threads;
+  for (int t = 0; t < THREADS; t++) threads.emplace_back([&, t] {
+    mt19937_64 rng(t);
+    for (int ti = 0; ti < TESTCASES; ti++) {
+      int N = rng() % 2000 + 1, M = rng() % 2000 + 1;
+      vector<long long> A(N), B(M);
+      for (auto &&ai : A) ai = rng() % int(1e4);
+      for (auto &&bi : B) bi = rng() % int(1e4);
+      vector<long long> C = mulPolyFFT(A, B, &plan);
+      assert(C == naiveMul(A, B, 0));
+      for (auto &&c : C) checkSums[t] = 31 * checkSums[t] + c;
+    }
+  });
+  for (auto &&t : threads) t.join();
+  long long checkSum = 0;
+  for (auto &&c : checkSums) checkSum = 31 * checkSum + c;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (FFTPlan) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  const int THREADS = 4, TESTCASES = 100;
+  NTTPlan<long long, MOD> plan(1 << 12);
+  vector<long long> checkSums(THREADS, 0);
+  vector<thread> threads;
+  for (int t = 0; t < THREADS; t++) threads.emplace_back([&, t] {
+    mt19937_64 rng(t);
+    for (int ti = 0; ti < TESTCASES; ti++) {
+      int N = rng() % 2000 + 1, M = rng() % 2000 + 1, K = N + M - 1;
+      while (K & (K - 1)) K++;
+      vector<long long> A(N), B(M);
+      for (auto &&ai : A) ai = rng() % MOD;
+      for (auto &&bi : B) bi = rng() % MOD;
+      vector<long long> FA(K, 0), FB(K, 0), C(K, 0);
+      copy(A.begin(), A.end(), FA.begin());
+      copy(B.begin(), B.end(), FB.begin());
+      if (ti % 2 == 0) {
+        ntt(FA, plan);
+        ntt(FB, plan);
+      } else {
+        ntt<long long, MOD>(FA);
+        ntt<long long, MOD>(FB);
+      }
+      long long invK = mulInvModPrime((long long)K, MOD);
+      for (int i = 0; i < K; i++) C[(K - i) & (K - 1)] = FA[i] * FB[i] % MOD * invK % MOD;
+      ntt(C, plan);
+      while (int(C.size()) > 1 && C.back() == 0) C.pop_back();
+      assert(C == naiveMul(A, B, MOD));
+      for (auto &&c : C) checkSums[t] = 31 * checkSums[t] + c;
+    }
+  });
+  for (auto &&t : threads) t.join();
+  long long checkSum = 0;
+  for (auto &&c : checkSums) checkSum = 31 * checkSum + c;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (NTTPlan) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/XorBasis.h"
+using namespace std;
+
+template <class T> vector<T> bruteBasis(const vector<T> &A, int l, int r) {
+  vector<T> b;
+  for (int i = l; i <= r; i++) {
+    T v = A[i];
+    for (auto &&bi : b) v = min(v, T(v ^ bi));
+    if (v) {
+      b.push_back(v);
+      sort(b.rbegin(), b.rend());
+    }
+  }
+  return b;
+}
+
+template <class T> T maxXor(const vector<T> &A, int l, int r, T x) {
+  vector<T> b = bruteBasis(A, l, r);
+  for (auto &&bi : b) x = max(x, T(x ^ bi));
+  return x;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 2000, QUERIES = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 50 + 1, B = rng() % 12 + 1;
+    vector<uint32_t> A(N);
+    for (auto &&a : A) a = rng() % (1 << B);
+    PrefixXorBasis<uint32_t, 12> pb(vector<uint32_t>(A.begin(), A.begin() + N / 2));
+    for (int i = N / 2; i < N; i++) pb.push_back(A[i]);
+    assert(pb.N == N);
+    vector<pair<int, int>> queries;
+    vector<uint32_t> expected;
+    for (int k = 0; k < QUERIES; k++) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      uint32_t x = rng() % 2 == 0 ? 0 : rng() % (1 << B);
+      uint32_t ans = maxXor(A, l, r, x);
+      assert(pb.rangeMaxXor(l, r, x) == ans);
+      vector<uint32_t> b = pb.rangeBasis(l, r);
+      uint32_t y = x;
+      for (auto &&bi : b) y = max(y, bi ^ y);
+      assert(y == ans);
+      uint32_t v = 0;
+      if (rng() % 2 == 0) v = rng() % (1 << B);
+      else for (int i = l; i <= r; i++) if (rng() % 2 == 0) v ^= A[i];
+      uint32_t w = v;
+      for (auto &&bi : bruteBasis(A, l, r)) w = min(w, w ^ bi);
+      assert(pb.inSpan(l, r, v) == (w == 0));
+      assert(int(b.size()) == int(bruteBasis(A, l, r).size()));
+      queries.emplace_back(l, r);
+      expected.push_back(maxXor(A, l, r, uint32_t(0)));
+      checkSum = 31 * checkSum + ans;
+    }
+    assert((rangeMaxXorOffline<uint32_t, 12>(A, queries) == expected));
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against brute force) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(1);
+  const int N = 5e5, Q = 2e6;
+  vector<uint32_t> A(N);
+  for (auto &&a : A) a = rng() % (1 << 20);
+  vector<pair<int, int>> queries(Q);
+  for (int k = 0; k < Q; k++) {
+    int l = rng() % N, r = rng() % N;
+    if (l > r) swap(l, r);
+    if (k % 1000 == 0) r = min(N - 1, l + int(rng() % 100));
+    queries[k] = make_pair(l, r);
+  }
+  PrefixXorBasis<uint32_t, 20> pb(A);
+  const auto online_time = chrono::system_clock::now();
+  long long checkSum = 0;
+  vector<uint32_t> online(Q);
+  for (int k = 0; k < Q; k++) online[k] = pb.rangeMaxXor(queries[k].first, queries[k].second);
+  const auto offline_time = chrono::system_clock::now();
+  vector<uint32_t> offline = rangeMaxXorOffline<uint32_t, 20>(A, queries);
+  const auto end_time = chrono::system_clock::now();
+  assert(online == offline);
+  for (int k = 0; k < Q; k += 1000) assert(online[k] == maxXor(A, queries[k].first, queries[k].second, uint32_t(0)));
+  for (auto &&x : online) checkSum = 31 * checkSum + x;
+  double build = ((online_time - start_time).count() / double(chrono::system_clock::period::den));
+  double onlineSec = ((offline_time - online_time).count() / double(chrono::system_clock::period::den));
+  double offlineSec = ((end_time - offline_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (large) Passed" << endl;
+  cout << "  N: " << N << ", Q: " << Q << endl;
+  cout << "  Time (build): " << fixed << setprecision(3) << build << "s" << endl;
+  cout << "  Time (online queries): " << fixed << setprecision(3) << onlineSec << "s" << endl;
+  cout << "  Time (offline queries): " << fixed << setprecision(3) << offlineSec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
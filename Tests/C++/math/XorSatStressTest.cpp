@@ -0,0 +1,138 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/XorSat.h"
+using namespace std;
+
+const int MAXN = 128;
+
+// mt19937_64 is linear over GF(2) with a state of 19937 bits, so its outputs are mixed with multiplications
+uint64_t randomWord(mt19937_64 &rng) {
+  uint64_t x = rng();
+  x ^= x >> 31;
+  x *= 0x7fb5d329728ea185ULL;
+  x ^= x >> 27;
+  x *= 0x81dadef4bc2dd44dULL;
+  return x ^ (x >> 33);
+}
+
+bool getBit(const vector<uint64_t> &v, int j) {
+  return v[j / 64] >> (j % 64) & 1;
+}
+
+// multiplies the packed M x N matrix A by the packed vector y
+vector<bool> multiply(int M, int N, const vector<uint64_t> &A, const vector<uint64_t> &y) {
+  int IW = (N + 63) / 64;
+  vector<bool> ret(M, false);
+  for (int i = 0; i < M; i++) {
+    uint64_t s = 0;
+    for (int k = 0; k < IW; k++) s ^= A[i * IW + k] & y[k];
+    ret[i] = __builtin_popcountll(s) & 1;
+  }
+  return ret;
+}
+
+int bruteRank(vector<bitset<MAXN>> A, int N) {
+  int r = 0;
+  for (int c = 0; c < N && r < int(A.size()); c++) {
+    int p = r;
+    while (p < int(A.size()) && !A[p][c]) p++;
+    if (p == int(A.size())) continue;
+    swap(A[p], A[r]);
+    for (int i = 0; i < int(A.size()); i++) if (i != r && A[i][c]) A[i] ^= A[r];
+    r++;
+  }
+  return r;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int M = rng() % MAXN + 1, N = rng() % MAXN + 1, IW = (N + 63) / 64;
+    int density = rng() % 100 + 1, rankCap = rng() % 3 == 0 ? rng() % min(M, N) + 1 : MAXN;
+    vector<bitset<MAXN>> rows(M);
+    for (int i = 0; i < M; i++) {
+      if (i < rankCap) {
+        for (int j = 0; j < N; j++) rows[i][j] = int(rng() % 100) < density;
+      } else {
+        for (int k = 0; k < rankCap; k++) if (rng() % 2) rows[i] ^= rows[k];
+      }
+    }
+    shuffle(rows.begin(), rows.end(), rng);
+    vector<uint64_t> A(M * IW, 0);
+    for (int i = 0; i < M; i++) for (int j = 0; j < N; j++) if (rows[i][j]) A[i * IW + j / 64] |= uint64_t(1) << (j % 64);
+    vector<bool> b(M);
+    if (rng() % 2) {
+      vector<uint64_t> y(IW, 0);
+      for (int j = 0; j < N; j++) if (rng() % 2) y[j / 64] |= uint64_t(1) << (j % 64);
+      b = multiply(M, N, A, y);
+    } else {
+      for (int i = 0; i < M; i++) b[i] = rng() % 2;
+    }
+    PackedXorSat s(M, N, A, b);
+    XorSat<MAXN> e(rows, b);
+    assert((s.solutions == PackedXorSat::NO_SOLUTION) == (e.solutions == XorSat<MAXN>::NO_SOLUTION));
+    if (s.solutions != PackedXorSat::NO_SOLUTION) assert((s.solutions == PackedXorSat::INF_SOLUTIONS) == (s.rank < N));
+    assert(s.rank == bruteRank(rows, N));
+    assert(int(s.nullspace.size()) == N - s.rank);
+    for (auto &&y : s.nullspace) assert(multiply(M, N, A, y) == vector<bool>(M, false));
+    vector<bitset<MAXN>> ns;
+    for (auto &&y : s.nullspace) {
+      ns.emplace_back();
+      for (int j = 0; j < N; j++) ns.back()[j] = getBit(y, j);
+    }
+    assert(bruteRank(ns, N) == N - s.rank);
+    if (s.solutions != PackedXorSat::NO_SOLUTION) assert(multiply(M, N, A, s.x) == b);
+    checkSum = 31 * checkSum + s.rank * 3 + s.solutions;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (against XorSat) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2(int subtest, int N, int deficiency) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(subtest);
+  int M = N, IW = (N + 63) / 64;
+  vector<uint64_t> A(M * IW);
+  for (auto &&a : A) a = randomWord(rng);
+  if (N % 64 != 0) for (int i = 0; i < M; i++) A[i * IW + IW - 1] &= (uint64_t(1) << (N % 64)) - 1;
+  for (int i = M - deficiency; i < M; i++) {
+    fill(A.begin() + i * IW, A.begin() + (i + 1) * IW, 0);
+    for (int k = 0; k < 3; k++) {
+      int r = rng() % (M - deficiency);
+      for (int j = 0; j < IW; j++) A[i * IW + j] ^= A[r * IW + j];
+    }
+  }
+  vector<uint64_t> y(IW);
+  for (auto &&v : y) v = rng();
+  if (N % 64 != 0) y[IW - 1] &= (uint64_t(1) << (N % 64)) - 1;
+  vector<bool> b = multiply(M, N, A, y);
+  const auto solve_time = chrono::system_clock::now();
+  PackedXorSat s(M, N, A, b);
+  const auto end_time = chrono::system_clock::now();
+  assert(s.solutions != PackedXorSat::NO_SOLUTION);
+  assert(multiply(M, N, A, s.x) == b);
+  for (auto &&z : s.nullspace) assert(multiply(M, N, A, z) == vector<bool>(M, false));
+  assert(s.rank <= N - deficiency && s.rank >= N - deficiency - 10);
+  double sec = ((end_time - solve_time).count() / double(chrono::system_clock::period::den));
+  double total = ((chrono::system_clock::now() - start_time).count() / double(chrono::system_clock::period::den));
+  long long checkSum = s.rank;
+  for (auto &&v : s.x) checkSum = 31 * checkSum + v;
+  cout << "Subtest " << subtest << " (large random system) Passed" << endl;
+  cout << "  N: " << N << ", rank: " << s.rank << endl;
+  cout << "  Time (solve): " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << total << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2(2, 2000, 5);
+  test2(3, 20000, 10);
+  cout << "Test Passed" << endl;
+  return 0;
+}